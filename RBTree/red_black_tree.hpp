@@ -3,10 +3,54 @@
 
 #include <memory>
 #include "../utilities/less.hpp"
+#include "../utilities/prefetch.hpp"
+#include "../algorithm/thread_pool.hpp"
+#include "../vector/vector.hpp"
 #include "../iterator/red_black_tree_iterator.hpp"
 
+#ifdef FT_TREE_COUNTERS
+# define FT_TREE_COUNT(field, amount) (_counters.field += (amount))
+#else
+# define FT_TREE_COUNT(field, amount) ((void)0)
+#endif
+
 namespace ft
 {
+    struct tree_counters
+    {
+        size_t  comparisons;
+        size_t  rotations;
+        size_t  recolorings;
+        size_t  visited;
+        size_t  searches;
+        size_t  inserts;
+        size_t  erases;
+
+        tree_counters() : comparisons(0), rotations(0), recolorings(0), visited(0), searches(0), inserts(0),
+                          erases(0) {}
+    };
+
+    struct tree_diagnostics
+    {
+        size_t  nodes;
+        size_t  height;
+        size_t  black_height;
+        double  average_depth;
+        size_t  red_violations;
+        size_t  black_violations;
+        size_t  order_violations;
+        size_t  link_violations;
+        bool    red_root;
+
+        tree_diagnostics() : nodes(0), height(0), black_height(0), average_depth(0), red_violations(0),
+                             black_violations(0), order_violations(0), link_violations(0), red_root(false) {}
+
+        size_t  violations() const
+        {
+            return red_violations + black_violations + order_violations + link_violations + red_root;
+        }
+    };
+
     template<class T, class Compare = ft::less<T>, class Allocator = std::allocator<T> >
     class red_black_tree
     {
@@ -16,12 +60,30 @@ namespace ft
         typedef Allocator                           allocator_type;
         typedef typename allocator_type::size_type  size_type;
         typedef typename allocator_type::pointer    node_pointer;
+
+        static const size_type  batch_width = 16;
+
+        explicit    red_black_tree(const allocator_type &allocator = allocator_type()) : _allocator(allocator) {}
+
+        struct segment
+        {
+            node_pointer    node;
+            bool            subtree;
+        };
         
         node_pointer  create_node(value_type node)
         {
             node_pointer  new_node = _allocator.allocate(1);
 
-            _allocator.construct(new_node, node);
+            try
+            {
+                _allocator.construct(new_node, node);
+            }
+            catch (...)
+            {
+                _allocator.deallocate(new_node, 1);
+                throw;
+            }
             return new_node;
         }
         
@@ -38,9 +100,9 @@ namespace ft
         {
             bool    color = node->isBlack;
 
-            node->isBlack = node->right->isBlack;
-            node->right->isBlack = color;
-            node->left->isBlack = color;
+            paint(node, node->right->isBlack);
+            paint(node->right, color);
+            paint(node->left, color);
         }
         
         node_pointer min_node(node_pointer node) const
@@ -59,25 +121,133 @@ namespace ft
             return node;
         }
         
-        node_pointer  find_node(node_pointer node, value_type key) const
+        node_pointer  find_node(node_pointer node, const value_type &key) const
         {
-            if (node)
+            FT_TREE_COUNT(searches, 1);
+            while (node)
             {
-                if (_compare(node->value, key))
-                    return find_node(node->right, key);
-                else if (_compare(key, node->value))
-                    return find_node(node->left, key);
+                FT_TREE_COUNT(visited, 1);
+                if (compare(node->value, key))
+                    node = node->right;
+                else if (compare(key, node->value))
+                    node = node->left;
+                else
+                    break;
             }
             return node;
         }
-        
+
+        void    find_batch(node_pointer root, const value_type *keys, size_type count, node_pointer *found) const
+        {
+            node_pointer    cursor[batch_width];
+
+            FT_TREE_COUNT(searches, count);
+            for (size_type first = 0; first < count; first += batch_width)
+            {
+                size_type   width = count - first < batch_width ? count - first : batch_width;
+                size_type   active = width;
+
+                for (size_type i = 0; i < width; ++i)
+                {
+                    cursor[i] = root;
+                    found[first + i] = 0;
+                }
+                while (active)
+                {
+                    active = 0;
+                    for (size_type i = 0; i < width; ++i)
+                    {
+                        node_pointer node = cursor[i];
+
+                        if (!node)
+                            continue;
+                        FT_TREE_COUNT(visited, 1);
+                        if (compare(node->value, keys[first + i]))
+                            node = node->right;
+                        else if (compare(keys[first + i], node->value))
+                            node = node->left;
+                        else
+                        {
+                            found[first + i] = node;
+                            node = 0;
+                        }
+                        cursor[i] = node;
+                        if (node)
+                        {
+                            ft::prefetch(node);
+                            ++active;
+                        }
+                    }
+                }
+            }
+        }
+
+        node_pointer  next_node(node_pointer node) const
+        {
+            if (node->right)
+                return min_node(node->right);
+            while (node->parent && node->parent->right == node)
+                node = node->parent;
+            return node->parent;
+        }
+
+        node_pointer  prev_node(node_pointer node) const
+        {
+            if (node->left)
+                return max_node(node->left);
+            while (node->parent && node->parent->left == node)
+                node = node->parent;
+            return node->parent;
+        }
+
+        // Climbs from finger to the lowest ancestor whose subtree bounds can contain key, so a search from
+        // the result costs the tree distance between the two nodes: O(log d) for keys d apart within one
+        // subtree, but O(log n) when they sit on either side of a high ancestor such as the root.
+        node_pointer  finger_start(node_pointer finger, const value_type &key) const
+        {
+            if (finger && compare(finger->value, key))
+            {
+                for (;;)
+                {
+                    node_pointer    spine = finger;
+
+                    while (spine->parent && spine->parent->right == spine)
+                        spine = spine->parent;
+                    if (!spine->parent || compare(key, spine->parent->value))
+                        return finger;
+                    FT_TREE_COUNT(visited, 1);
+                    finger = spine->parent;
+                    if (!compare(finger->value, key))
+                        return finger;
+                }
+            }
+            if (finger && compare(key, finger->value))
+            {
+                for (;;)
+                {
+                    node_pointer    spine = finger;
+
+                    while (spine->parent && spine->parent->left == spine)
+                        spine = spine->parent;
+                    if (!spine->parent || compare(spine->parent->value, key))
+                        return finger;
+                    FT_TREE_COUNT(visited, 1);
+                    finger = spine->parent;
+                    if (!compare(key, finger->value))
+                        return finger;
+                }
+            }
+            return finger;
+        }
+
         node_pointer  lower(node_pointer root, value_type key) const
         {
             node_pointer node = 0;
 
             while (root)
             {
-                if (_compare(root->value, key))
+                FT_TREE_COUNT(visited, 1);
+                if (compare(root->value, key))
                     root = root->right;
                 else
                 {
@@ -114,6 +284,219 @@ namespace ft
         {
             return _allocator.max_size();
         }
+
+        allocator_type  get_allocator() const
+        {
+            return _allocator;
+        }
+
+        tree_counters   counters() const
+        {
+#ifdef FT_TREE_COUNTERS
+            return _counters;
+#else
+            return tree_counters();
+#endif
+        }
+
+        void    reset_counters()
+        {
+#ifdef FT_TREE_COUNTERS
+            _counters = tree_counters();
+#endif
+        }
+
+        tree_diagnostics    diagnostics(node_pointer root) const
+        {
+            tree_diagnostics        result;
+            ft::vector<probe>       pending;
+            size_t                  depth_sum = 0;
+            bool                    leaf_seen = false;
+
+            if (!root)
+                return result;
+            result.red_root = !root->isBlack;
+            result.link_violations += root->parent != 0;
+            pending.push_back(probe(root, 1, root->isBlack, 0, 0));
+            while (!pending.empty())
+            {
+                probe   current = pending.back();
+
+                pending.pop_back();
+                if (!current.node)
+                {
+                    if (!leaf_seen)
+                        result.black_height = current.black;
+                    else if (current.black != result.black_height)
+                        ++result.black_violations;
+                    leaf_seen = true;
+                    continue;
+                }
+
+                node_pointer    node = current.node;
+
+                ++result.nodes;
+                depth_sum += current.depth;
+                if (current.depth > result.height)
+                    result.height = current.depth;
+                if ((current.lower && !_compare(current.lower->value, node->value))
+                    || (current.upper && !_compare(node->value, current.upper->value)))
+                    ++result.order_violations;
+                for (size_t side = 0; side < 2; ++side)
+                {
+                    node_pointer    child = side ? node->right : node->left;
+
+                    if (child && child->parent != node)
+                        ++result.link_violations;
+                    if (child && !node->isBlack && !child->isBlack)
+                        ++result.red_violations;
+                    pending.push_back(probe(child, current.depth + 1, current.black + (child ? child->isBlack : 1),
+                                            side ? node : current.lower, side ? current.upper : node));
+                }
+            }
+            result.average_depth = (double)depth_sum / result.nodes;
+            return result;
+        }
+
+        node_pointer    clone(node_pointer source, node_pointer parent)
+        {
+            if (!source)
+                return 0;
+
+            node_pointer    node = create_node(source->value);
+
+            node->isBlack = source->isBlack;
+            node->parent = parent;
+            try
+            {
+                node->left = clone(source->left, node);
+                node->right = clone(source->right, node);
+            }
+            catch (...)
+            {
+                clear(&node);
+                throw;
+            }
+            return node;
+        }
+
+        size_type   split_depth(size_type threads) const
+        {
+            size_type   depth = 0;
+
+            while (((size_type)1 << depth) < threads * 8)
+                ++depth;
+            return depth;
+        }
+
+        void    split(node_pointer node, size_type depth, ft::vector<segment> &parts) const
+        {
+            if (!node)
+                return;
+
+            segment part = {node, !depth};
+
+            if (depth)
+                split(node->left, depth - 1, parts);
+            parts.push_back(part);
+            if (depth)
+                split(node->right, depth - 1, parts);
+        }
+
+        bool    in_range(const value_type &value, const value_type *lower, const value_type *upper) const
+        {
+            return (!lower || !_compare(value, *lower)) && (!upper || _compare(value, *upper));
+        }
+
+        template <class Visitor>
+        void    visit(node_pointer node, const value_type *lower, const value_type *upper, Visitor &visitor) const
+        {
+            while (node)
+            {
+                if (lower && _compare(node->value, *lower))
+                    node = node->right;
+                else if (upper && !_compare(node->value, *upper))
+                    node = node->left;
+                else
+                {
+                    visit(node->left, lower, 0, visitor);
+                    visitor(node->value);
+                    node = node->right;
+                    lower = 0;
+                }
+            }
+        }
+
+        template <class Visitor>
+        void    parallel_visit(thread_pool *pool, node_pointer root, const value_type *lower,
+                               const value_type *upper, ft::vector<Visitor> &visitors) const
+        {
+            if (!pool || pool->size() == 1)
+            {
+                visit(root, lower, upper, visitors[0]);
+                return;
+            }
+
+            ft::vector<segment> parts;
+
+            split(root, split_depth(pool->size()), parts);
+            if (parts.empty())
+                return;
+            visitors.resize(parts.size(), visitors[0]);
+
+            visit_job<Visitor>  job = {this, &parts[0], &visitors[0], lower, upper};
+
+            pool->parallel_for(0, parts.size(), 1, job.run, &job);
+        }
+
+        node_pointer    parallel_clone(thread_pool *pool, node_pointer source)
+        {
+            if (!pool || pool->size() == 1)
+                return clone(source, 0);
+
+            ft::vector<clone_task>  tasks;
+            node_pointer            root = 0;
+
+            try
+            {
+                clone_top(source, 0, &root, split_depth(pool->size()), tasks);
+                if (!tasks.empty())
+                {
+                    clone_job   job = {this, &tasks[0]};
+
+                    pool->parallel_for(0, tasks.size(), 1, job.run, &job);
+                }
+            }
+            catch (...)
+            {
+                clear(&root);
+                throw;
+            }
+            return root;
+        }
+
+        void    parallel_clear(thread_pool *pool, node_pointer *root)
+        {
+            if (!pool || pool->size() == 1)
+            {
+                clear(root);
+                return;
+            }
+
+            ft::vector<segment> parts;
+
+            split(*root, split_depth(pool->size()), parts);
+            if (!parts.empty())
+            {
+                clear_job   job = {this, &parts[0]};
+
+                pool->parallel_for(0, parts.size(), 1, job.run, &job);
+            }
+            for (size_type i = 0; i < parts.size(); ++i)
+                if (!parts[i].subtree)
+                    delete_node(parts[i].node);
+            *root = 0;
+        }
         
         void        insert_balance(node_pointer *root, node_pointer node)
         {
@@ -147,9 +530,9 @@ namespace ft
                                 {
                                     rotate_right(parent, root);
                                     parent = node;
+                                    paint(parent, false);
                                 }
-                                if (parent->right == node)
-                                    rotate_left(grand, root);
+                                rotate_left(grand, root);
                                 node = parent->parent;
                             }
                             else
@@ -159,8 +542,7 @@ namespace ft
                                     rotate_left(parent, root);
                                     parent = node;
                                 }
-                                if (parent->left == node)
-                                    rotate_right(grand, root);
+                                rotate_right(grand, root);
                                 node = parent->parent;
                             }
                         }
@@ -170,7 +552,7 @@ namespace ft
                 }
                 else
                 {
-                    node->isBlack = true;
+                    paint(node, true);
                     node = node->parent;
                 }
             }
@@ -178,23 +560,31 @@ namespace ft
         
         bool        insert(node_pointer *root, node_pointer new_node)
         {
+            return insert_from(root, *root, new_node);
+        }
+
+        bool        insert_from(node_pointer *root, node_pointer start, node_pointer &new_node)
+        {
+            FT_TREE_COUNT(inserts, 1);
             if (!(*root))
              {
                 *root = new_node;
-                new_node->isBlack = true;
+                paint(new_node, true);
             }
             else
             {
-                node_pointer tmp = *root;
+                node_pointer tmp = start ? start : *root;
                 while (tmp)
                 {
-                    if (!_compare(tmp->value, new_node->value) && !_compare(new_node->value, tmp->value))
+                    FT_TREE_COUNT(visited, 1);
+                    if (!compare(tmp->value, new_node->value) && !compare(new_node->value, tmp->value))
                     {
                         if (tmp != new_node)
                             delete_node(new_node);
+                        new_node = tmp;
                         return false;
                     }
-                    else if (_compare(new_node->value, tmp->value))
+                    else if (compare(new_node->value, tmp->value))
                     {
                         if (tmp->left)
                             tmp = tmp->left;
@@ -222,190 +612,152 @@ namespace ft
             return true;
         }
         
-        void        pointers_swap(node_pointer remove, node_pointer replace)
-        {
-            if (remove->parent)
-            {
-                if (remove->parent->left == remove)
-                    remove->parent->left = replace;
-                else
-                    remove->parent->right = replace;
-            }
-            replace->parent = remove->parent;
-            if (remove->left)
-            {
-                remove->left->parent = replace;
-            }
-            replace->left = remove->left;
-            if (remove->right)
-            {
-                remove->right->parent = replace;
-            }
-            replace->right = remove->right;
-            replace->isBlack = remove->isBlack;
-        }
-        
         bool        erase(node_pointer *root, value_type key)
         {
             node_pointer remove = find_node(*root, key);
 
             if (remove)
             {
-                node_pointer replace = 0;
-                if (remove->left)
-                    replace = erase_left(remove, root);
-                else if (remove->right)
-                    replace = erase_right(remove, root);
-                else
-                    erase_not_child(remove, root);
-                if (replace)
-                    pointers_swap(remove, replace);
-                if (remove == *root)
-                {
-                    if (replace)
-                        *root = replace;
-                    else
-                        *root = 0;
-                }
-                delete_node(remove);
+                erase_node(root, remove);
                 return true;
             }
             return false;
         }
 
-        node_pointer    erase_left(node_pointer node, node_pointer *root)
+        void        erase_node(node_pointer *root, node_pointer remove)
         {
-            node_pointer replace = max_node(node->left);
+            FT_TREE_COUNT(erases, 1);
 
-            if (replace)
+            node_pointer    replace = remove;
+            node_pointer    child;
+            node_pointer    parent;
+            bool            removed_black = remove->isBlack;
+
+            if (!remove->left || !remove->right)
             {
-                if (replace == node->left)
-                {
-                    node->left = replace->left;
-                    if (replace->left)
-                        replace->left->parent = node;
-                }
+                child = remove->left ? remove->left : remove->right;
+                parent = remove->parent;
+                transplant(root, remove, child);
+            }
+            else
+            {
+                replace = min_node(remove->right);
+                removed_black = replace->isBlack;
+                child = replace->right;
+                if (replace->parent == remove)
+                    parent = replace;
                 else
                 {
-                    replace->parent->right = replace->left;
-                    if (replace->left)
-                        replace->left->parent = replace->parent;
-                }
-                if (replace->isBlack == true)
-                {
-                    if (replace->left && replace->left->isBlack == false)
-                        replace->left->isBlack = true;
-                    erase_balance(root, replace->parent);
+                    parent = replace->parent;
+                    transplant(root, replace, replace->right);
+                    replace->right = remove->right;
+                    replace->right->parent = replace;
                 }
+                transplant(root, remove, replace);
+                replace->left = remove->left;
+                replace->left->parent = replace;
+                paint(replace, remove->isBlack);
             }
-            return replace;
+            if (removed_black)
+                erase_balance(root, child, parent);
+            delete_node(remove);
         }
 
-        node_pointer    erase_right(node_pointer node, node_pointer *root)
+        void        transplant(node_pointer *root, node_pointer node, node_pointer replace)
         {
-            node_pointer replace = min_node(node->right);
-
+            if (!node->parent)
+                *root = replace;
+            else if (node->parent->left == node)
+                node->parent->left = replace;
+            else
+                node->parent->right = replace;
             if (replace)
-            {
-                if (replace == node->right)
-                {
-                    node->right = replace->right;
-                    if (replace->right)
-                        replace->right->parent = node;
-                }
-                else
-                {
-                    replace->parent->left = replace->right;
-                    if (replace->right)
-                        replace->right->parent = replace->parent;
-                }
-                if (replace->isBlack == true)
-                {
-                    if (replace->right && replace->right->isBlack == false)
-                        replace->right->isBlack = true;
-                    erase_balance(root, replace->parent);
-                }
-            }
-            return replace;
+                replace->parent = node->parent;
         }
 
-        node_pointer    erase_not_child(node_pointer node, node_pointer *root)
+        bool        is_black(node_pointer node) const
         {
-            node_pointer replace = node;
-
-            if (replace && replace->parent)
-            {
-                if (replace->parent->right == replace)
-                    replace->parent->right = 0;
-                else
-                    replace->parent->left = 0;
-                if (replace->isBlack == true)
-                {
-                    if (replace->right && replace->right->isBlack == false)
-                        replace->right->isBlack = true;
-                    erase_balance(root, replace->parent);
-                }
-            }
-            return replace;
+            return !node || node->isBlack;
         }
 
-        void            erase_balance(node_pointer *root, node_pointer node)
+        void        erase_balance(node_pointer *root, node_pointer node, node_pointer parent)
         {
-            node_pointer right;
-            node_pointer left;
-            node_pointer brother;
+            node_pointer    brother;
+            bool            color;
 
-            while (node != *root && node->isBlack)
+            while (node != *root && is_black(node))
             {
-                brother = node->right;
-                if (brother)
+                if (node == parent->left)
                 {
-                    right = brother->right;
-                    left = brother->left;
-                    if ((right || left) && (!right || right->isBlack == true) &&
-                        (!left || left->isBlack == true))
+                    brother = parent->right;
+                    if (!brother->isBlack)
                     {
-                        if (brother->isBlack == true)
-                        {
-                            brother->isBlack = false;
-                            node->isBlack = true;
-                            rotate_left(node, root);
-                        }
-                        else
-                            node = node->parent;
+                        rotate_left(parent, root);
+                        paint(brother, true);
+                        paint(parent, false);
+                        brother = parent->right;
                     }
-                    else if (right && brother->isBlack == true)
+                    if (is_black(brother->left) && is_black(brother->right))
                     {
-                        if (left && left->isBlack == false &&
-                            right->isBlack == true)
-                        {
-                            rotate_right(brother, root);
-                            right = brother;
-                            brother = left;
-                        }
-                        if (right->isBlack == false &&
-                            (!left || left->isBlack == true || !node->left))
-                            rotate_left(node, root);
-                        else
-                            node = node->parent;
+                        paint(brother, false);
+                        node = parent;
+                        parent = node->parent;
+                        continue;
                     }
-                    else if (brother->isBlack == true &&
-                             node->isBlack == false)
+                    if (is_black(brother->right))
                     {
-                        node->isBlack = true;
-                        brother->isBlack = false;
-                        node = node->parent;
+                        rotate_right(brother, root);
+                        paint(brother, false);
+                        brother = parent->right;
+                        paint(brother, true);
                     }
-                    else
-                        node = node->parent;
+                    color = parent->isBlack;
+                    rotate_left(parent, root);
+                    paint(brother, color);
+                    paint(parent, true);
+                    if (brother->right)
+                        paint(brother->right, true);
                 }
                 else
-                    break;
+                {
+                    brother = parent->left;
+                    if (!brother->isBlack)
+                    {
+                        rotate_right(parent, root);
+                        paint(brother, true);
+                        paint(parent, false);
+                        brother = parent->left;
+                    }
+                    if (is_black(brother->left) && is_black(brother->right))
+                    {
+                        paint(brother, false);
+                        node = parent;
+                        parent = node->parent;
+                        continue;
+                    }
+                    if (is_black(brother->left))
+                    {
+                        rotate_left(brother, root);
+                        paint(brother, false);
+                        brother = parent->left;
+                        paint(brother, true);
+                    }
+                    color = parent->isBlack;
+                    rotate_right(parent, root);
+                    paint(brother, color);
+                    paint(parent, true);
+                    if (brother->left)
+                        paint(brother->left, true);
+                }
+                node = *root;
             }
+            if (node)
+                paint(node, true);
         }
 
         void        rotate_left(node_pointer node, node_pointer *root)
         {
+            FT_TREE_COUNT(rotations, 1);
             node_pointer right = node->right;
             right->parent = node->parent;
 
@@ -427,14 +779,15 @@ namespace ft
             }
             right->left = node;
             bool color = node->isBlack;
-            node->isBlack = right->isBlack;
-            right->isBlack = color;
+            paint(node, right->isBlack);
+            paint(right, color);
             if (!right->parent)
                 *root = right;
         }
 
         void        rotate_right(node_pointer node, node_pointer *root)
         {
+            FT_TREE_COUNT(rotations, 1);
             node_pointer left = node->left;
             left->parent = node->parent;
 
@@ -455,8 +808,8 @@ namespace ft
                     node->left->parent = node;
             }
             left->right = node;
-            node->isBlack = false;
-            left->isBlack = true;
+            paint(node, false);
+            paint(left, true);
             if (!left->parent)
                 *root = left;
         }
@@ -464,6 +817,121 @@ namespace ft
     private:
         allocator_type  _allocator;
         key_compare     _compare;
+#ifdef FT_TREE_COUNTERS
+        mutable tree_counters   _counters;
+#endif
+
+        struct probe
+        {
+            node_pointer    node;
+            size_t          depth;
+            size_t          black;
+            node_pointer    lower;
+            node_pointer    upper;
+
+            probe(node_pointer current = 0, size_t level = 0, size_t blacks = 0, node_pointer low = 0,
+                  node_pointer high = 0) : node(current), depth(level), black(blacks), lower(low), upper(high) {}
+        };
+
+        bool    compare(const value_type &lhs, const value_type &rhs) const
+        {
+            FT_TREE_COUNT(comparisons, 1);
+            return _compare(lhs, rhs);
+        }
+
+        void    paint(node_pointer node, bool black)
+        {
+            FT_TREE_COUNT(recolorings, node->isBlack != black);
+            node->isBlack = black;
+        }
+
+        struct clone_task
+        {
+            node_pointer    source;
+            node_pointer    parent;
+            node_pointer    *slot;
+        };
+
+        template <class Visitor>
+        struct visit_job
+        {
+            const red_black_tree    *tree;
+            const segment           *parts;
+            Visitor                 *visitors;
+            const value_type        *lower;
+            const value_type        *upper;
+
+            static void run(void *context, size_t first, size_t last)
+            {
+                visit_job   *job = static_cast<visit_job *>(context);
+
+                for (size_t i = first; i < last; ++i)
+                {
+                    node_pointer    node = job->parts[i].node;
+
+                    if (job->parts[i].subtree)
+                        job->tree->visit(node, job->lower, job->upper, job->visitors[i]);
+                    else if (job->tree->in_range(node->value, job->lower, job->upper))
+                        job->visitors[i](node->value);
+                }
+            }
+        };
+
+        struct clone_job
+        {
+            red_black_tree  *tree;
+            clone_task      *tasks;
+
+            static void run(void *context, size_t first, size_t last)
+            {
+                clone_job   *job = static_cast<clone_job *>(context);
+
+                for (size_t i = first; i < last; ++i)
+                    *job->tasks[i].slot = job->tree->clone(job->tasks[i].source, job->tasks[i].parent);
+            }
+        };
+
+        struct clear_job
+        {
+            red_black_tree  *tree;
+            segment         *parts;
+
+            static void run(void *context, size_t first, size_t last)
+            {
+                clear_job   *job = static_cast<clear_job *>(context);
+
+                for (size_t i = first; i < last; ++i)
+                {
+                    if (job->parts[i].subtree)
+                        job->tree->clear(&job->parts[i].node);
+                }
+            }
+        };
+
+        void    clone_top(node_pointer source, node_pointer parent, node_pointer *slot, size_type depth,
+                          ft::vector<clone_task> &tasks)
+        {
+            if (!source)
+            {
+                *slot = 0;
+                return;
+            }
+            if (!depth)
+            {
+                clone_task  task = {source, parent, slot};
+
+                tasks.push_back(task);
+                return;
+            }
+
+            node_pointer    node = create_node(source->value);
+
+            node->isBlack = source->isBlack;
+            node->parent = parent;
+            *slot = node;
+            clone_top(source->left, node, &node->left, depth - 1, tasks);
+            clone_top(source->right, node, &node->right, depth - 1, tasks);
+        }
     };
 }
 
@@ -0,0 +1,457 @@
+#ifndef RADIX_NODE_HPP
+#define RADIX_NODE_HPP
+
+#include <cstring>
+#include <stdint.h>
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+    namespace radix
+    {
+        enum kind_type { node4, node16, node48, node256 };
+
+        enum { max_prefix = 8 };
+
+        struct node
+        {
+            uint8_t         kind;
+            uint16_t        count;
+            uint32_t        prefix_length;
+            unsigned char   prefix[max_prefix];
+
+            explicit node(kind_type type) : kind(type), count(0), prefix_length(0) {}
+        };
+
+        struct node_4 : node
+        {
+            unsigned char   keys[4];
+            void            *children[4];
+
+            node_4() : node(node4) {}
+        };
+
+        struct node_16 : node
+        {
+            unsigned char   keys[16];
+            void            *children[16];
+
+            node_16() : node(node16) {}
+        };
+
+        struct node_48 : node
+        {
+            unsigned char   index[256];
+            void            *children[48];
+
+            node_48() : node(node48)
+            {
+                std::memset(index, 0, sizeof(index));
+            }
+        };
+
+        struct node_256 : node
+        {
+            void    *children[256];
+
+            node_256() : node(node256)
+            {
+                std::memset(children, 0, sizeof(children));
+            }
+        };
+
+        inline bool     is_leaf(const void *child)
+        {
+            return (uintptr_t)child & 1;
+        }
+
+        inline void     *tag_leaf(void *leaf)
+        {
+            return (void *)((uintptr_t)leaf | 1);
+        }
+
+        inline void     *untag_leaf(const void *child)
+        {
+            return (void *)((uintptr_t)child & ~(uintptr_t)1);
+        }
+
+        inline size_t   node_size(const node *n)
+        {
+            switch (n->kind)
+            {
+                case node4:
+                    return sizeof(node_4);
+                case node16:
+                    return sizeof(node_16);
+                case node48:
+                    return sizeof(node_48);
+                default:
+                    return sizeof(node_256);
+            }
+        }
+
+        inline void     copy_header(node *to, const node *from)
+        {
+            to->count = from->count;
+            to->prefix_length = from->prefix_length;
+            std::memcpy(to->prefix, from->prefix, max_prefix);
+        }
+
+        inline void     **find_child(node *n, unsigned char byte)
+        {
+            switch (n->kind)
+            {
+                case node4:
+                {
+                    node_4  *small = static_cast<node_4 *>(n);
+
+                    for (unsigned i = 0; i < small->count; ++i)
+                        if (small->keys[i] == byte)
+                            return &small->children[i];
+                    return 0;
+                }
+                case node16:
+                {
+                    node_16 *medium = static_cast<node_16 *>(n);
+#if defined(__SSE2__)
+                    __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8((char)byte),
+                                                     _mm_loadu_si128((const __m128i *)medium->keys));
+                    unsigned mask = (unsigned)_mm_movemask_epi8(matches) & ((1u << medium->count) - 1);
+
+                    return mask ? &medium->children[__builtin_ctz(mask)] : 0;
+#else
+                    for (unsigned i = 0; i < medium->count; ++i)
+                        if (medium->keys[i] == byte)
+                            return &medium->children[i];
+                    return 0;
+#endif
+                }
+                case node48:
+                {
+                    node_48 *large = static_cast<node_48 *>(n);
+
+                    return large->index[byte] ? &large->children[large->index[byte] - 1] : 0;
+                }
+                default:
+                {
+                    node_256    *full = static_cast<node_256 *>(n);
+
+                    return full->children[byte] ? &full->children[byte] : 0;
+                }
+            }
+        }
+
+        inline void     *next_child(const node *n, int byte)
+        {
+            switch (n->kind)
+            {
+                case node4:
+                case node16:
+                {
+                    const unsigned char *keys = n->kind == node4 ? static_cast<const node_4 *>(n)->keys
+                                                                 : static_cast<const node_16 *>(n)->keys;
+                    void *const         *children = n->kind == node4 ? static_cast<const node_4 *>(n)->children
+                                                                     : static_cast<const node_16 *>(n)->children;
+
+                    for (unsigned i = 0; i < n->count; ++i)
+                        if (keys[i] > byte)
+                            return children[i];
+                    return 0;
+                }
+                case node48:
+                {
+                    const node_48   *large = static_cast<const node_48 *>(n);
+
+                    for (int i = byte + 1; i < 256; ++i)
+                        if (large->index[i])
+                            return large->children[large->index[i] - 1];
+                    return 0;
+                }
+                default:
+                {
+                    const node_256  *full = static_cast<const node_256 *>(n);
+
+                    for (int i = byte + 1; i < 256; ++i)
+                        if (full->children[i])
+                            return full->children[i];
+                    return 0;
+                }
+            }
+        }
+
+        inline void     *previous_child(const node *n, int byte)
+        {
+            switch (n->kind)
+            {
+                case node4:
+                case node16:
+                {
+                    const unsigned char *keys = n->kind == node4 ? static_cast<const node_4 *>(n)->keys
+                                                                 : static_cast<const node_16 *>(n)->keys;
+                    void *const         *children = n->kind == node4 ? static_cast<const node_4 *>(n)->children
+                                                                     : static_cast<const node_16 *>(n)->children;
+
+                    for (unsigned i = n->count; i > 0; --i)
+                        if (keys[i - 1] < byte)
+                            return children[i - 1];
+                    return 0;
+                }
+                case node48:
+                {
+                    const node_48   *large = static_cast<const node_48 *>(n);
+
+                    for (int i = byte - 1; i >= 0; --i)
+                        if (large->index[i])
+                            return large->children[large->index[i] - 1];
+                    return 0;
+                }
+                default:
+                {
+                    const node_256  *full = static_cast<const node_256 *>(n);
+
+                    for (int i = byte - 1; i >= 0; --i)
+                        if (full->children[i])
+                            return full->children[i];
+                    return 0;
+                }
+            }
+        }
+
+        template <class Small>
+        void    insert_sorted(Small *n, unsigned char byte, void *child)
+        {
+            unsigned    position = 0;
+
+            while (position < n->count && n->keys[position] < byte)
+                ++position;
+            std::memmove(n->keys + position + 1, n->keys + position, n->count - position);
+            std::memmove(n->children + position + 1, n->children + position, (n->count - position) * sizeof(void *));
+            n->keys[position] = byte;
+            n->children[position] = child;
+            ++n->count;
+        }
+
+        template <class Small>
+        void    remove_sorted(Small *n, unsigned position)
+        {
+            std::memmove(n->keys + position, n->keys + position + 1, n->count - position - 1);
+            std::memmove(n->children + position, n->children + position + 1,
+                         (n->count - position - 1) * sizeof(void *));
+            --n->count;
+        }
+
+        inline void     add_child(node *&ref, unsigned char byte, void *child)
+        {
+            node    *n = ref;
+
+            switch (n->kind)
+            {
+                case node4:
+                {
+                    node_4  *small = static_cast<node_4 *>(n);
+
+                    if (small->count < 4)
+                        return insert_sorted(small, byte, child);
+
+                    node_16 *grown = new node_16;
+
+                    copy_header(grown, small);
+                    std::memcpy(grown->keys, small->keys, 4);
+                    std::memcpy(grown->children, small->children, 4 * sizeof(void *));
+                    delete small;
+                    ref = grown;
+                    return insert_sorted(grown, byte, child);
+                }
+                case node16:
+                {
+                    node_16 *medium = static_cast<node_16 *>(n);
+
+                    if (medium->count < 16)
+                        return insert_sorted(medium, byte, child);
+
+                    node_48 *grown = new node_48;
+
+                    copy_header(grown, medium);
+                    for (unsigned i = 0; i < 16; ++i)
+                    {
+                        grown->index[medium->keys[i]] = (unsigned char)(i + 1);
+                        grown->children[i] = medium->children[i];
+                    }
+                    delete medium;
+                    ref = grown;
+                    n = grown;
+                }
+                /* fall through */
+                case node48:
+                {
+                    node_48 *large = static_cast<node_48 *>(n);
+
+                    if (large->count < 48)
+                    {
+                        large->index[byte] = (unsigned char)(large->count + 1);
+                        large->children[large->count++] = child;
+                        return;
+                    }
+
+                    node_256    *grown = new node_256;
+
+                    copy_header(grown, large);
+                    for (unsigned i = 0; i < 256; ++i)
+                        if (large->index[i])
+                            grown->children[i] = large->children[large->index[i] - 1];
+                    delete large;
+                    ref = grown;
+                    n = grown;
+                }
+                /* fall through */
+                default:
+                {
+                    node_256    *full = static_cast<node_256 *>(n);
+
+                    full->children[byte] = child;
+                    ++full->count;
+                }
+            }
+        }
+
+        inline void     remove_child(node *&ref, unsigned char byte)
+        {
+            node    *n = ref;
+
+            switch (n->kind)
+            {
+                case node4:
+                {
+                    node_4  *small = static_cast<node_4 *>(n);
+
+                    for (unsigned i = 0; i < small->count; ++i)
+                        if (small->keys[i] == byte)
+                            return remove_sorted(small, i);
+                    return;
+                }
+                case node16:
+                {
+                    node_16 *medium = static_cast<node_16 *>(n);
+
+                    for (unsigned i = 0; i < medium->count; ++i)
+                        if (medium->keys[i] == byte)
+                        {
+                            remove_sorted(medium, i);
+                            break;
+                        }
+                    if (medium->count > 3)
+                        return;
+
+                    node_4  *shrunk = new node_4;
+
+                    copy_header(shrunk, medium);
+                    std::memcpy(shrunk->keys, medium->keys, medium->count);
+                    std::memcpy(shrunk->children, medium->children, medium->count * sizeof(void *));
+                    delete medium;
+                    ref = shrunk;
+                    return;
+                }
+                case node48:
+                {
+                    node_48     *large = static_cast<node_48 *>(n);
+                    unsigned    slot = large->index[byte] - 1;
+                    unsigned    last = large->count - 1;
+
+                    if (slot != last)
+                    {
+                        for (unsigned i = 0; i < 256; ++i)
+                            if (large->index[i] == last + 1)
+                            {
+                                large->index[i] = (unsigned char)(slot + 1);
+                                break;
+                            }
+                        large->children[slot] = large->children[last];
+                    }
+                    large->index[byte] = 0;
+                    if (--large->count > 12)
+                        return;
+
+                    node_16 *shrunk = new node_16;
+
+                    copy_header(shrunk, large);
+                    shrunk->count = 0;
+                    for (unsigned i = 0; i < 256; ++i)
+                        if (large->index[i])
+                        {
+                            shrunk->keys[shrunk->count] = (unsigned char)i;
+                            shrunk->children[shrunk->count++] = large->children[large->index[i] - 1];
+                        }
+                    delete large;
+                    ref = shrunk;
+                    return;
+                }
+                default:
+                {
+                    node_256    *full = static_cast<node_256 *>(n);
+
+                    full->children[byte] = 0;
+                    if (--full->count > 37)
+                        return;
+
+                    node_48 *shrunk = new node_48;
+
+                    copy_header(shrunk, full);
+                    shrunk->count = 0;
+                    for (unsigned i = 0; i < 256; ++i)
+                        if (full->children[i])
+                        {
+                            shrunk->index[i] = (unsigned char)(shrunk->count + 1);
+                            shrunk->children[shrunk->count++] = full->children[i];
+                        }
+                    delete full;
+                    ref = shrunk;
+                }
+            }
+        }
+
+        inline unsigned collect_children(const node *n, void **out)
+        {
+            unsigned    count = 0;
+
+            switch (n->kind)
+            {
+                case node4:
+                    std::memcpy(out, static_cast<const node_4 *>(n)->children, n->count * sizeof(void *));
+                    return n->count;
+                case node16:
+                    std::memcpy(out, static_cast<const node_16 *>(n)->children, n->count * sizeof(void *));
+                    return n->count;
+                case node48:
+                    std::memcpy(out, static_cast<const node_48 *>(n)->children, n->count * sizeof(void *));
+                    return n->count;
+                default:
+                    for (unsigned i = 0; i < 256; ++i)
+                        if (static_cast<const node_256 *>(n)->children[i])
+                            out[count++] = static_cast<const node_256 *>(n)->children[i];
+                    return count;
+            }
+        }
+
+        inline void     delete_node(node *n)
+        {
+            switch (n->kind)
+            {
+                case node4:
+                    delete static_cast<node_4 *>(n);
+                    break;
+                case node16:
+                    delete static_cast<node_16 *>(n);
+                    break;
+                case node48:
+                    delete static_cast<node_48 *>(n);
+                    break;
+                default:
+                    delete static_cast<node_256 *>(n);
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,237 @@
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#include "thread_pool.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../utilities/plus.hpp"
+#include "../vector/vector.hpp"
+
+namespace ft
+{
+    namespace execution
+    {
+        struct sequenced_policy {};
+
+        struct parallel_policy
+        {
+            thread_pool *pool;
+            size_t      grain;
+
+            parallel_policy() : pool(0), grain(0) {}
+
+            explicit parallel_policy(thread_pool &executor, size_t chunk = 0) : pool(&executor), grain(chunk) {}
+
+            thread_pool &executor() const
+            {
+                return pool ? *pool : thread_pool::instance();
+            }
+        };
+
+        static const sequenced_policy   seq = sequenced_policy();
+        static const parallel_policy    par = parallel_policy();
+    }
+
+    template <class Iter, class Function>
+    struct for_each_job
+    {
+        Iter        first;
+        Function    function;
+
+        for_each_job(Iter begin, Function f) : first(begin), function(f) {}
+
+        static void run(void *context, size_t first, size_t last)
+        {
+            for_each_job    *job = static_cast<for_each_job *>(context);
+            Iter            it = job->first + first;
+
+            for (size_t i = first; i < last; ++i, ++it)
+                job->function(*it);
+        }
+    };
+
+    template <class Iter, class OutIter, class Operation>
+    struct transform_job
+    {
+        Iter        first;
+        OutIter     out;
+        Operation   operation;
+
+        transform_job(Iter begin, OutIter d_begin, Operation op) : first(begin), out(d_begin), operation(op) {}
+
+        static void run(void *context, size_t first, size_t last)
+        {
+            transform_job   *job = static_cast<transform_job *>(context);
+            Iter            it = job->first + first;
+            OutIter         out = job->out + first;
+
+            for (size_t i = first; i < last; ++i, ++it, ++out)
+                *out = job->operation(*it);
+        }
+    };
+
+    template <class Iter, class T, class Operation>
+    struct reduce_job
+    {
+        struct slot
+        {
+            T       value;
+            bool    filled;
+
+            slot() : value(), filled(false) {}
+        };
+
+        Iter                first;
+        Operation           operation;
+        size_t              grain;
+        ft::vector<slot>    partials;
+
+        reduce_job(Iter begin, Operation op, size_t chunk, size_t chunks)
+            : first(begin), operation(op), grain(chunk), partials(chunks) {}
+
+        static void run(void *context, size_t first, size_t last)
+        {
+            reduce_job  *job = static_cast<reduce_job *>(context);
+            Iter        it = job->first + first;
+            T           partial = *it;
+
+            ++it;
+            for (size_t i = first + 1; i < last; ++i, ++it)
+                partial = job->operation(partial, *it);
+            job->partials[first / job->grain].value = partial;
+            job->partials[first / job->grain].filled = true;
+        }
+    };
+
+    template <class Iter, class Predicate>
+    struct count_if_job
+    {
+        Iter                first;
+        Predicate           predicate;
+        size_t              grain;
+        ft::vector<size_t>  counts;
+
+        count_if_job(Iter begin, Predicate pred, size_t chunk, size_t chunks)
+            : first(begin), predicate(pred), grain(chunk), counts(chunks, 0) {}
+
+        static void run(void *context, size_t first, size_t last)
+        {
+            count_if_job    *job = static_cast<count_if_job *>(context);
+            Iter            it = job->first + first;
+            size_t          count = 0;
+
+            for (size_t i = first; i < last; ++i, ++it)
+                if (job->predicate(*it))
+                    ++count;
+            job->counts[first / job->grain] = count;
+        }
+    };
+
+    inline size_t   parallel_grain(const execution::parallel_policy &policy, size_t total)
+    {
+        size_t  chunks = policy.executor().size() * 8;
+
+        if (policy.grain)
+            return policy.grain;
+        return total / chunks > 1 ? total / chunks : 1;
+    }
+
+    template <class Iter, class Function>
+    void    for_each(const execution::sequenced_policy &, Iter first, Iter last, Function function)
+    {
+        for (; first != last; ++first)
+            function(*first);
+    }
+
+    template <class Iter, class Function>
+    void    for_each(const execution::parallel_policy &policy, Iter first, Iter last, Function function)
+    {
+        size_t                          total = last - first;
+        for_each_job<Iter, Function>    job(first, function);
+
+        policy.executor().parallel_for(0, total, parallel_grain(policy, total), job.run, &job);
+    }
+
+    template <class Iter, class OutIter, class Operation>
+    OutIter transform(const execution::sequenced_policy &, Iter first, Iter last, OutIter out, Operation operation)
+    {
+        for (; first != last; ++first, ++out)
+            *out = operation(*first);
+        return out;
+    }
+
+    template <class Iter, class OutIter, class Operation>
+    OutIter transform(const execution::parallel_policy &policy, Iter first, Iter last, OutIter out,
+                      Operation operation)
+    {
+        size_t                                  total = last - first;
+        transform_job<Iter, OutIter, Operation> job(first, out, operation);
+
+        policy.executor().parallel_for(0, total, parallel_grain(policy, total), job.run, &job);
+        return out + total;
+    }
+
+    template <class Iter, class T, class Operation>
+    T       reduce(const execution::sequenced_policy &, Iter first, Iter last, T init, Operation operation)
+    {
+        for (; first != last; ++first)
+            init = operation(init, *first);
+        return init;
+    }
+
+    template <class Iter, class T, class Operation>
+    T       reduce(const execution::parallel_policy &policy, Iter first, Iter last, T init, Operation operation)
+    {
+        size_t                          total = last - first;
+        size_t                          grain = parallel_grain(policy, total);
+        size_t                          chunks = (total + grain - 1) / grain;
+        reduce_job<Iter, T, Operation>  job(first, operation, grain, chunks);
+
+        policy.executor().parallel_for(0, total, grain, job.run, &job);
+        for (size_t i = 0; i < chunks; ++i)
+            if (job.partials[i].filled)
+                init = operation(init, job.partials[i].value);
+        return init;
+    }
+
+    template <class Iter, class T>
+    T       reduce(const execution::sequenced_policy &policy, Iter first, Iter last, T init)
+    {
+        return ft::reduce(policy, first, last, init, ft::plus<T>());
+    }
+
+    template <class Iter, class T>
+    T       reduce(const execution::parallel_policy &policy, Iter first, Iter last, T init)
+    {
+        return ft::reduce(policy, first, last, init, ft::plus<T>());
+    }
+
+    template <class Iter, class Predicate>
+    typename ft::iterator_traits<Iter>::difference_type
+            count_if(const execution::sequenced_policy &, Iter first, Iter last, Predicate predicate)
+    {
+        typename ft::iterator_traits<Iter>::difference_type count = 0;
+
+        for (; first != last; ++first)
+            if (predicate(*first))
+                ++count;
+        return count;
+    }
+
+    template <class Iter, class Predicate>
+    typename ft::iterator_traits<Iter>::difference_type
+            count_if(const execution::parallel_policy &policy, Iter first, Iter last, Predicate predicate)
+    {
+        size_t                          total = last - first;
+        size_t                          grain = parallel_grain(policy, total);
+        size_t                          chunks = (total + grain - 1) / grain;
+        count_if_job<Iter, Predicate>   job(first, predicate, grain, chunks);
+        size_t                          count = 0;
+
+        policy.executor().parallel_for(0, total, grain, job.run, &job);
+        for (size_t i = 0; i < chunks; ++i)
+            count += job.counts[i];
+        return count;
+    }
+}
+
+#endif
@@ -0,0 +1,883 @@
+#ifndef SORT_HPP
+#define SORT_HPP
+
+#include <cstddef>
+#include <limits>
+#include "parallel.hpp"
+#include "../iterator/iterator_traits.hpp"
+#include "../utilities/utilities.hpp"
+#include "../vector/vector.hpp"
+
+namespace ft
+{
+    template <size_t Size>
+    struct radix_unsigned;
+
+    template <>
+    struct radix_unsigned<1>
+    {
+        typedef unsigned char       type;
+    };
+
+    template <>
+    struct radix_unsigned<2>
+    {
+        typedef unsigned short      type;
+    };
+
+    template <>
+    struct radix_unsigned<4>
+    {
+        typedef unsigned int        type;
+    };
+
+    template <>
+    struct radix_unsigned<8>
+    {
+        typedef unsigned long long  type;
+    };
+
+    template <class T>
+    unsigned int    radix_byte(T value, size_t byte)
+    {
+        typedef typename ft::radix_unsigned<sizeof(T)>::type    bits_type;
+
+        bits_type   bits = (bits_type)value;
+
+        if (std::numeric_limits<T>::is_signed)
+            bits ^= (bits_type)1 << (sizeof(T) * 8 - 1);
+        return (unsigned int)(bits >> (byte * 8)) & 0xff;
+    }
+
+    template <class T>
+    struct radix_traits
+    {
+        static const bool   enabled = ft::is_integral<T>::value;
+        static const size_t bytes = sizeof(T);
+
+        static unsigned int byte(const T &value, size_t index)
+        {
+            return ft::radix_byte(value, index);
+        }
+    };
+
+    template <class K, class V>
+    struct radix_traits<ft::pair<K, V> >
+    {
+        static const bool   enabled = ft::is_integral<K>::value && ft::is_integral<V>::value;
+        static const size_t bytes = sizeof(K) + sizeof(V);
+
+        static unsigned int byte(const ft::pair<K, V> &value, size_t index)
+        {
+            if (index < sizeof(V))
+                return ft::radix_byte(value.second, index);
+            return ft::radix_byte(value.first, index - sizeof(V));
+        }
+    };
+
+    template <class T, class Key>
+    struct radix_key_traits
+    {
+        typedef typename Key::result_type   key_type;
+
+        static const size_t bytes = sizeof(key_type);
+
+        Key     key;
+
+        explicit radix_key_traits(const Key &function) : key(function) {}
+
+        unsigned int    byte(const T &value, size_t index) const
+        {
+            return ft::radix_byte(key(value), index);
+        }
+    };
+
+    template <class Key, class Value>
+    struct select_first : less_function<ft::pair<Key, Value>, ft::pair<Key, Value>, Key>
+    {
+        Key operator()(const ft::pair<Key, Value> &value) const
+        {
+            return value.first;
+        }
+    };
+
+    static const std::ptrdiff_t sort_insertion_threshold = 24;
+    static const std::ptrdiff_t sort_ninther_threshold = 128;
+    static const std::ptrdiff_t sort_partial_insertion_limit = 8;
+    static const size_t         sort_block_size = 64;
+    static const size_t         sort_radix_threshold = 256;
+
+    template <class Iter>
+    void    iter_swap(Iter a, Iter b)
+    {
+        ft::swap(*a, *b);
+    }
+
+    /*
+     * insertion_sort through pdq_sort below are adapted from pdqsort.h (Pattern-defeating quicksort),
+     * https://github.com/orlp/pdqsort, under the following license:
+     *
+     *     Copyright (c) 2021 Orson Peters
+     *
+     *     This software is provided 'as-is', without any express or implied warranty. In no event will the
+     *     authors be held liable for any damages arising from the use of this software.
+     *
+     *     Permission is granted to anyone to use this software for any purpose, including commercial
+     *     applications, and to alter it and redistribute it freely, subject to the following restrictions:
+     *
+     *     1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+     *        original software. If you use this software in a product, an acknowledgment in the product
+     *        documentation would be appreciated but is not required.
+     *
+     *     2. Altered source versions must be plainly marked as such, and must not be misrepresented as
+     *        being the original software.
+     *
+     *     3. This notice may not be removed or altered from any source distribution.
+     *
+     * This is an altered version: it is reformatted into the ft namespace, always uses the branchless
+     * block partition instead of selecting it with a template parameter, and falls back to ft::heap_sort
+     * instead of std::make_heap/std::sort_heap.
+     */
+
+    template <class Iter, class Compare>
+    void    insertion_sort(Iter begin, Iter end, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (begin == end)
+            return;
+        for (Iter cur = begin + 1; cur != end; ++cur)
+        {
+            Iter    sift = cur;
+            Iter    sift_1 = cur - 1;
+
+            if (comp(*sift, *sift_1))
+            {
+                T   tmp = *sift;
+
+                do
+                {
+                    *sift = *sift_1;
+                    --sift;
+                }
+                while (sift != begin && comp(tmp, *--sift_1));
+                *sift = tmp;
+            }
+        }
+    }
+
+    template <class Iter, class Compare>
+    void    unguarded_insertion_sort(Iter begin, Iter end, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (begin == end)
+            return;
+        for (Iter cur = begin + 1; cur != end; ++cur)
+        {
+            Iter    sift = cur;
+            Iter    sift_1 = cur - 1;
+
+            if (comp(*sift, *sift_1))
+            {
+                T   tmp = *sift;
+
+                do
+                {
+                    *sift = *sift_1;
+                    --sift;
+                }
+                while (comp(tmp, *--sift_1));
+                *sift = tmp;
+            }
+        }
+    }
+
+    template <class Iter, class Compare>
+    bool    partial_insertion_sort(Iter begin, Iter end, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        std::ptrdiff_t  limit = 0;
+
+        if (begin == end)
+            return true;
+        for (Iter cur = begin + 1; cur != end; ++cur)
+        {
+            if (limit > sort_partial_insertion_limit)
+                return false;
+
+            Iter    sift = cur;
+            Iter    sift_1 = cur - 1;
+
+            if (comp(*sift, *sift_1))
+            {
+                T   tmp = *sift;
+
+                do
+                {
+                    *sift = *sift_1;
+                    --sift;
+                }
+                while (sift != begin && comp(tmp, *--sift_1));
+                *sift = tmp;
+                limit += cur - sift;
+            }
+        }
+        return true;
+    }
+
+    template <class Iter, class Compare>
+    void    sort2(Iter a, Iter b, Compare comp)
+    {
+        if (comp(*b, *a))
+            ft::iter_swap(a, b);
+    }
+
+    template <class Iter, class Compare>
+    void    sort3(Iter a, Iter b, Iter c, Compare comp)
+    {
+        ft::sort2(a, b, comp);
+        ft::sort2(b, c, comp);
+        ft::sort2(a, b, comp);
+    }
+
+    template <class Iter, class Compare>
+    void    sift_down(Iter begin, std::ptrdiff_t root, std::ptrdiff_t size, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        T   value = *(begin + root);
+
+        for (std::ptrdiff_t child = 2 * root + 1; child < size; child = 2 * root + 1)
+        {
+            if (child + 1 < size && comp(*(begin + child), *(begin + (child + 1))))
+                ++child;
+            if (!comp(value, *(begin + child)))
+                break;
+            *(begin + root) = *(begin + child);
+            root = child;
+        }
+        *(begin + root) = value;
+    }
+
+    template <class Iter, class Compare>
+    void    heap_sort(Iter begin, Iter end, Compare comp)
+    {
+        std::ptrdiff_t  size = end - begin;
+
+        for (std::ptrdiff_t root = size / 2; root > 0; --root)
+            ft::sift_down(begin, root - 1, size, comp);
+        for (std::ptrdiff_t last = size - 1; last > 0; --last)
+        {
+            ft::iter_swap(begin, begin + last);
+            ft::sift_down(begin, 0, last, comp);
+        }
+    }
+
+    template <class Iter>
+    void    swap_offsets(Iter first, Iter last, unsigned char *offsets_l, unsigned char *offsets_r,
+                         size_t count, bool use_swaps)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (use_swaps)
+        {
+            for (size_t i = 0; i < count; ++i)
+                ft::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+        }
+        else if (count > 0)
+        {
+            Iter    l = first + offsets_l[0];
+            Iter    r = last - offsets_r[0];
+            T       tmp = *l;
+
+            *l = *r;
+            for (size_t i = 1; i < count; ++i)
+            {
+                l = first + offsets_l[i];
+                *r = *l;
+                r = last - offsets_r[i];
+                *l = *r;
+            }
+            *r = tmp;
+        }
+    }
+
+    template <class Iter, class Compare>
+    ft::pair<Iter, bool>    partition_right_branchless(Iter begin, Iter end, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        T       pivot = *begin;
+        Iter    first = begin;
+        Iter    last = end;
+
+        while (comp(*++first, pivot))
+            ;
+        if (first - 1 == begin)
+            while (first < last && !comp(*--last, pivot))
+                ;
+        else
+            while (!comp(*--last, pivot))
+                ;
+
+        bool    already_partitioned = first >= last;
+
+        if (!already_partitioned)
+        {
+            ft::iter_swap(first, last);
+            ++first;
+
+            unsigned char   offsets_l[sort_block_size];
+            unsigned char   offsets_r[sort_block_size];
+            Iter            offsets_l_base = first;
+            Iter            offsets_r_base = last;
+            size_t          num_l = 0;
+            size_t          num_r = 0;
+            size_t          start_l = 0;
+            size_t          start_r = 0;
+
+            while (first < last)
+            {
+                size_t  num_unknown = last - first;
+                size_t  left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                size_t  right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+                if (left_split > sort_block_size)
+                    left_split = sort_block_size;
+                if (right_split > sort_block_size)
+                    right_split = sort_block_size;
+                for (size_t i = 0; i < left_split; )
+                {
+                    offsets_l[num_l] = i++;
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                }
+                for (size_t i = 0; i < right_split; )
+                {
+                    offsets_r[num_r] = ++i;
+                    num_r += comp(*--last, pivot);
+                }
+
+                size_t  count = num_l < num_r ? num_l : num_r;
+
+                ft::swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                                 count, num_l == num_r);
+                num_l -= count;
+                num_r -= count;
+                start_l += count;
+                start_r += count;
+                if (num_l == 0)
+                {
+                    start_l = 0;
+                    offsets_l_base = first;
+                }
+                if (num_r == 0)
+                {
+                    start_r = 0;
+                    offsets_r_base = last;
+                }
+            }
+            if (num_l)
+            {
+                while (num_l--)
+                    ft::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                first = last;
+            }
+            if (num_r)
+            {
+                while (num_r--)
+                {
+                    ft::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                    ++first;
+                }
+            }
+        }
+
+        Iter    pivot_pos = first - 1;
+
+        *begin = *pivot_pos;
+        *pivot_pos = pivot;
+        return ft::pair<Iter, bool>(pivot_pos, already_partitioned);
+    }
+
+    template <class Iter, class Compare>
+    Iter    partition_left(Iter begin, Iter end, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        T       pivot = *begin;
+        Iter    first = begin;
+        Iter    last = end;
+
+        while (comp(pivot, *--last))
+            ;
+        if (last + 1 == end)
+            while (first < last && !comp(pivot, *++first))
+                ;
+        else
+            while (!comp(pivot, *++first))
+                ;
+        while (first < last)
+        {
+            ft::iter_swap(first, last);
+            while (comp(pivot, *--last))
+                ;
+            while (!comp(pivot, *++first))
+                ;
+        }
+
+        Iter    pivot_pos = last;
+
+        *begin = *pivot_pos;
+        *pivot_pos = pivot;
+        return pivot_pos;
+    }
+
+    template <class Iter, class Compare>
+    void    pdq_sort_loop(Iter begin, Iter end, Compare comp, int bad_allowed, bool leftmost)
+    {
+        for (;;)
+        {
+            std::ptrdiff_t  size = end - begin;
+
+            if (size < sort_insertion_threshold)
+            {
+                if (leftmost)
+                    ft::insertion_sort(begin, end, comp);
+                else
+                    ft::unguarded_insertion_sort(begin, end, comp);
+                return;
+            }
+
+            std::ptrdiff_t  s2 = size / 2;
+
+            if (size > sort_ninther_threshold)
+            {
+                ft::sort3(begin, begin + s2, end - 1, comp);
+                ft::sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+                ft::sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+                ft::sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+                ft::iter_swap(begin, begin + s2);
+            }
+            else
+                ft::sort3(begin + s2, begin, end - 1, comp);
+
+            if (!leftmost && !comp(*(begin - 1), *begin))
+            {
+                begin = ft::partition_left(begin, end, comp) + 1;
+                continue;
+            }
+
+            ft::pair<Iter, bool>    result = ft::partition_right_branchless(begin, end, comp);
+            Iter                    pivot_pos = result.first;
+            std::ptrdiff_t          l_size = pivot_pos - begin;
+            std::ptrdiff_t          r_size = end - (pivot_pos + 1);
+
+            if (l_size < size / 8 || r_size < size / 8)
+            {
+                if (--bad_allowed == 0)
+                {
+                    ft::heap_sort(begin, end, comp);
+                    return;
+                }
+                if (l_size >= sort_insertion_threshold)
+                {
+                    ft::iter_swap(begin, begin + l_size / 4);
+                    ft::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                    if (l_size > sort_ninther_threshold)
+                    {
+                        ft::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                        ft::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                        ft::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                        ft::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                    }
+                }
+                if (r_size >= sort_insertion_threshold)
+                {
+                    ft::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                    ft::iter_swap(end - 1, end - r_size / 4);
+                    if (r_size > sort_ninther_threshold)
+                    {
+                        ft::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                        ft::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                        ft::iter_swap(end - 2, end - (1 + r_size / 4));
+                        ft::iter_swap(end - 3, end - (2 + r_size / 4));
+                    }
+                }
+            }
+            else if (result.second && ft::partial_insertion_sort(begin, pivot_pos, comp)
+                     && ft::partial_insertion_sort(pivot_pos + 1, end, comp))
+                return;
+            ft::pdq_sort_loop(begin, pivot_pos, comp, bad_allowed, leftmost);
+            begin = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+
+    template <class Iter, class Compare>
+    void    pdq_sort(Iter begin, Iter end, Compare comp)
+    {
+        int bad_allowed = 1;
+
+        if (begin == end)
+            return;
+        for (std::ptrdiff_t size = end - begin; size > 1; size >>= 1)
+            ++bad_allowed;
+        ft::pdq_sort_loop(begin, end, comp, bad_allowed, true);
+    }
+
+    /* End of the code adapted from pdqsort. */
+
+    template <class Iter, class Traits>
+    void    radix_sort_with(Iter first, Iter last, const Traits &traits, size_t bytes)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        size_t          size = last - first;
+        ft::vector<T>   data(first, last);
+        ft::vector<T>   scratch(data);
+        ft::vector<size_t> counts(bytes * 256, 0);
+        T               *source = &data[0];
+        T               *target = &scratch[0];
+
+        for (size_t i = 0; i < size; ++i)
+            for (size_t byte = 0; byte < bytes; ++byte)
+                ++counts[byte * 256 + traits.byte(source[i], byte)];
+        for (size_t byte = 0; byte < bytes; ++byte)
+        {
+            size_t  *count = &counts[byte * 256];
+            size_t  offset = 0;
+
+            if (count[traits.byte(source[0], byte)] == size)
+                continue;
+            for (size_t bucket = 0; bucket < 256; ++bucket)
+            {
+                size_t  current = count[bucket];
+
+                count[bucket] = offset;
+                offset += current;
+            }
+            for (size_t i = 0; i < size; ++i)
+                target[count[traits.byte(source[i], byte)]++] = source[i];
+            ft::swap(source, target);
+        }
+        for (size_t i = 0; i < size; ++i, ++first)
+            *first = source[i];
+    }
+
+    template <class Iter>
+    void    radix_sort(Iter first, Iter last)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (last - first > 1)
+            ft::radix_sort_with(first, last, ft::radix_traits<T>(), ft::radix_traits<T>::bytes);
+    }
+
+    template <class Iter, class Key>
+    void    radix_sort(Iter first, Iter last, Key key)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+        typedef ft::radix_key_traits<T, Key>                    traits_type;
+
+        if (last - first > 1)
+            ft::radix_sort_with(first, last, traits_type(key), traits_type::bytes);
+    }
+
+    template <class Iter, class Compare>
+    bool    sort_presorted(Iter first, Iter last, Compare comp)
+    {
+        Iter    cur = first + 1;
+
+        if (last - first < 2)
+            return true;
+        if (!comp(*cur, *first))
+        {
+            while (++cur != last && !comp(*cur, *(cur - 1)))
+                ;
+            return cur == last;
+        }
+        while (++cur != last && comp(*cur, *(cur - 1)))
+            ;
+        if (cur != last)
+            return false;
+        for (--last; first < last; ++first, --last)
+            ft::iter_swap(first, last);
+        return true;
+    }
+
+    template <class Iter, class Compare>
+    void    merge_runs(Iter first, Iter middle, Iter last, Iter out, Compare comp)
+    {
+        Iter    left = first;
+        Iter    right = middle;
+
+        while (left != middle && right != last)
+        {
+            if (comp(*right, *left))
+                *out++ = *right++;
+            else
+                *out++ = *left++;
+        }
+        while (left != middle)
+            *out++ = *left++;
+        while (right != last)
+            *out++ = *right++;
+    }
+
+    template <class Iter, class Compare>
+    void    merge_sort(Iter first, Iter last, Compare comp)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        size_t  size = last - first;
+
+        if (size <= (size_t)sort_insertion_threshold)
+        {
+            ft::insertion_sort(first, last, comp);
+            return;
+        }
+        if (ft::sort_presorted(first, last, comp))
+            return;
+
+        ft::vector<T>   buffer(first, last);
+        T               *source = &buffer[0];
+        ft::vector<T>   scratch(buffer);
+        T               *target = &scratch[0];
+        size_t          width = sort_insertion_threshold;
+
+        for (size_t begin = 0; begin < size; begin += width)
+            ft::insertion_sort(source + begin, source + (begin + width < size ? begin + width : size), comp);
+        for (; width < size; width *= 2)
+        {
+            for (size_t begin = 0; begin < size; begin += 2 * width)
+            {
+                size_t  middle = begin + width < size ? begin + width : size;
+                size_t  end = begin + 2 * width < size ? begin + 2 * width : size;
+
+                ft::merge_runs(source + begin, source + middle, source + end, target + begin, comp);
+            }
+            ft::swap(source, target);
+        }
+        for (size_t i = 0; i < size; ++i, ++first)
+            *first = source[i];
+    }
+
+    template <class Iter>
+    void    sort_dispatch(Iter first, Iter last, ft::integral<bool, true>)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (ft::sort_presorted(first, last, ft::less<T>()))
+            return;
+        if ((size_t)(last - first) >= sort_radix_threshold)
+            ft::radix_sort(first, last);
+        else
+            ft::pdq_sort(first, last, ft::less<typename ft::iterator_traits<Iter>::value_type>());
+    }
+
+    template <class Iter>
+    void    sort_dispatch(Iter first, Iter last, ft::integral<bool, false>)
+    {
+        ft::pdq_sort(first, last, ft::less<typename ft::iterator_traits<Iter>::value_type>());
+    }
+
+    template <class Iter>
+    void    stable_sort_dispatch(Iter first, Iter last, ft::integral<bool, true>)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        if (ft::sort_presorted(first, last, ft::less<T>()))
+            return;
+        if ((size_t)(last - first) >= sort_radix_threshold)
+            ft::radix_sort(first, last);
+        else
+            ft::insertion_sort(first, last, ft::less<typename ft::iterator_traits<Iter>::value_type>());
+    }
+
+    template <class Iter>
+    void    stable_sort_dispatch(Iter first, Iter last, ft::integral<bool, false>)
+    {
+        ft::merge_sort(first, last, ft::less<typename ft::iterator_traits<Iter>::value_type>());
+    }
+
+    template <class Iter>
+    void    sort(Iter first, Iter last)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        ft::sort_dispatch(first, last, ft::integral<bool, ft::radix_traits<T>::enabled>());
+    }
+
+    template <class Iter, class Compare>
+    void    sort(Iter first, Iter last, Compare comp)
+    {
+        ft::pdq_sort(first, last, comp);
+    }
+
+    template <class Iter>
+    void    stable_sort(Iter first, Iter last)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        ft::stable_sort_dispatch(first, last, ft::integral<bool, ft::radix_traits<T>::enabled>());
+    }
+
+    template <class Iter, class Compare>
+    void    stable_sort(Iter first, Iter last, Compare comp)
+    {
+        ft::merge_sort(first, last, comp);
+    }
+
+    template <class Iter, class Compare>
+    struct parallel_sort_job
+    {
+        Iter    first;
+        Compare comp;
+        size_t  grain;
+        size_t  size;
+        bool    stable;
+        bool    natural;
+
+        static void sort_chunks(void *context, size_t first, size_t last)
+        {
+            parallel_sort_job   *job = static_cast<parallel_sort_job *>(context);
+
+            for (size_t begin = first; begin < last; begin += job->grain)
+            {
+                Iter    chunk_first = job->first + begin;
+                Iter    chunk_last = job->first + (begin + job->grain < job->size ? begin + job->grain : job->size);
+
+                if (job->natural && job->stable)
+                    ft::stable_sort(chunk_first, chunk_last);
+                else if (job->natural)
+                    ft::sort(chunk_first, chunk_last);
+                else if (job->stable)
+                    ft::stable_sort(chunk_first, chunk_last, job->comp);
+                else
+                    ft::sort(chunk_first, chunk_last, job->comp);
+            }
+        }
+    };
+
+    template <class T, class Compare>
+    struct parallel_merge_job
+    {
+        T       *source;
+        T       *target;
+        Compare comp;
+        size_t  width;
+        size_t  size;
+
+        static void merge_pairs(void *context, size_t first, size_t last)
+        {
+            parallel_merge_job  *job = static_cast<parallel_merge_job *>(context);
+
+            for (size_t pair = first; pair < last; ++pair)
+            {
+                size_t  begin = pair * 2 * job->width;
+                size_t  middle = begin + job->width < job->size ? begin + job->width : job->size;
+                size_t  end = begin + 2 * job->width < job->size ? begin + 2 * job->width : job->size;
+
+                ft::merge_runs(job->source + begin, job->source + middle, job->source + end,
+                               job->target + begin, job->comp);
+            }
+        }
+    };
+
+    template <class Iter, class Compare>
+    void    parallel_sort(const execution::parallel_policy &policy, Iter first, Iter last, Compare comp,
+                          bool stable, bool natural)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        thread_pool &pool = policy.executor();
+        size_t      size = last - first;
+        size_t      chunks = pool.size();
+        size_t      grain = chunks ? (size + chunks - 1) / chunks : size;
+
+        if (chunks <= 1 || size < 2 * sort_radix_threshold * chunks)
+        {
+            parallel_sort_job<Iter, Compare>    job = {first, comp, size ? size : 1, size, stable, natural};
+
+            job.sort_chunks(&job, 0, size);
+            return;
+        }
+
+        parallel_sort_job<Iter, Compare>    sort_job = {first, comp, grain, size, stable, natural};
+
+        pool.parallel_for(0, size, grain, sort_job.sort_chunks, &sort_job);
+
+        ft::vector<T>   buffer(first, last);
+        ft::vector<T>   scratch(buffer);
+        T               *source = &buffer[0];
+        T               *target = &scratch[0];
+
+        for (size_t width = grain; width < size; width *= 2)
+        {
+            parallel_merge_job<T, Compare>  merge_job = {source, target, comp, width, size};
+            size_t                          pairs = (size + 2 * width - 1) / (2 * width);
+
+            pool.parallel_for(0, pairs, 1, merge_job.merge_pairs, &merge_job);
+            ft::swap(source, target);
+        }
+        for (size_t i = 0; i < size; ++i, ++first)
+            *first = source[i];
+    }
+
+    template <class Iter>
+    void    sort(const execution::sequenced_policy &, Iter first, Iter last)
+    {
+        ft::sort(first, last);
+    }
+
+    template <class Iter, class Compare>
+    void    sort(const execution::sequenced_policy &, Iter first, Iter last, Compare comp)
+    {
+        ft::sort(first, last, comp);
+    }
+
+    template <class Iter>
+    void    sort(const execution::parallel_policy &policy, Iter first, Iter last)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        ft::parallel_sort(policy, first, last, ft::less<T>(), false, true);
+    }
+
+    template <class Iter, class Compare>
+    void    sort(const execution::parallel_policy &policy, Iter first, Iter last, Compare comp)
+    {
+        ft::parallel_sort(policy, first, last, comp, false, false);
+    }
+
+    template <class Iter>
+    void    stable_sort(const execution::sequenced_policy &, Iter first, Iter last)
+    {
+        ft::stable_sort(first, last);
+    }
+
+    template <class Iter, class Compare>
+    void    stable_sort(const execution::sequenced_policy &, Iter first, Iter last, Compare comp)
+    {
+        ft::stable_sort(first, last, comp);
+    }
+
+    template <class Iter>
+    void    stable_sort(const execution::parallel_policy &policy, Iter first, Iter last)
+    {
+        typedef typename ft::iterator_traits<Iter>::value_type  T;
+
+        ft::parallel_sort(policy, first, last, ft::less<T>(), true, true);
+    }
+
+    template <class Iter, class Compare>
+    void    stable_sort(const execution::parallel_policy &policy, Iter first, Iter last, Compare comp)
+    {
+        ft::parallel_sort(policy, first, last, comp, true, false);
+    }
+}
+
+#endif
@@ -0,0 +1,292 @@
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <exception>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "../deque/deque.hpp"
+#include "../vector/vector.hpp"
+#include "../utilities/atomic.hpp"
+
+namespace ft
+{
+    class thread_pool
+    {
+    public:
+        typedef void    (*range_function)(void *context, size_t first, size_t last);
+
+        explicit    thread_pool(size_t threads = 0) : _stopping(false), _sleeping(0)
+        {
+            if (!threads)
+                threads = hardware_threads();
+            _queues = new queue[threads];
+            _count = threads;
+            pthread_mutex_init(&_idle_lock, 0);
+            pthread_cond_init(&_idle, 0);
+            for (size_t i = 1; i < threads; ++i)
+                _arguments.push_back(worker_argument(this, i));
+            _threads.assign(threads - 1, pthread_t());
+            for (size_t i = 1; i < threads; ++i)
+                pthread_create(&_threads[i - 1], 0, worker_main, &_arguments[i - 1]);
+        }
+
+        ~thread_pool()
+        {
+            pthread_mutex_lock(&_idle_lock);
+            _stopping = true;
+            pthread_cond_broadcast(&_idle);
+            pthread_mutex_unlock(&_idle_lock);
+            for (size_t i = 0; i < _threads.size(); ++i)
+                pthread_join(_threads[i], 0);
+            pthread_cond_destroy(&_idle);
+            pthread_mutex_destroy(&_idle_lock);
+            delete[] _queues;
+        }
+
+        size_t  size() const
+        {
+            return _count;
+        }
+
+        void    parallel_for(size_t first, size_t last, size_t grain, range_function function, void *context)
+        {
+            size_t  total = last - first;
+
+            if (!grain)
+                grain = total / (_count * 8) > 1 ? total / (_count * 8) : 1;
+            if (_count == 1 || total <= grain)
+            {
+                if (first != last)
+                    function(context, first, last);
+                return;
+            }
+
+            job     batch;
+            size_t  home = 0;
+
+            batch.pending = (total + grain - 1) / grain;
+            batch.failed = 0;
+
+            for (size_t begin = first; begin < last; begin += grain, ++home)
+            {
+                task    work;
+
+                work.function = function;
+                work.context = context;
+                work.first = begin;
+                work.last = last - begin > grain ? begin + grain : last;
+                work.batch = &batch;
+                _queues[home % _count].push(work);
+            }
+            wake();
+            for (unsigned long spins = 0; ft::atomic_load(&batch.pending) > 0; )
+            {
+                task    work;
+
+                if (find_task(0, work))
+                {
+                    execute(work);
+                    spins = 0;
+                }
+                else if (++spins < 64)
+                    ft::cpu_relax();
+                else
+                    sched_yield();
+            }
+            if (batch.failed)
+                std::rethrow_exception(batch.error);
+        }
+
+        static size_t   hardware_threads()
+        {
+            long    count = sysconf(_SC_NPROCESSORS_ONLN);
+
+            return count > 0 ? count : 1;
+        }
+
+        static thread_pool  &instance()
+        {
+            static thread_pool  pool;
+
+            return pool;
+        }
+
+    private:
+        struct job
+        {
+            long                pending;
+            int                 failed;
+            std::exception_ptr  error;
+        };
+
+        struct task
+        {
+            range_function  function;
+            void            *context;
+            size_t          first;
+            size_t          last;
+            job             *batch;
+        };
+
+        struct queue
+        {
+            pthread_mutex_t lock;
+            ft::deque<task> tasks;
+            char            padding[ft::cache_line_size];
+
+            queue()
+            {
+                pthread_mutex_init(&lock, 0);
+            }
+
+            ~queue()
+            {
+                pthread_mutex_destroy(&lock);
+            }
+
+            void    push(const task &work)
+            {
+                pthread_mutex_lock(&lock);
+                tasks.push_back(work);
+                pthread_mutex_unlock(&lock);
+            }
+
+            bool    pop_back(task &work)
+            {
+                bool    found = false;
+
+                pthread_mutex_lock(&lock);
+                if (!tasks.empty())
+                {
+                    work = tasks.back();
+                    tasks.pop_back();
+                    found = true;
+                }
+                pthread_mutex_unlock(&lock);
+                return found;
+            }
+
+            bool    steal(task &work)
+            {
+                bool    found = false;
+
+                pthread_mutex_lock(&lock);
+                if (!tasks.empty())
+                {
+                    work = tasks.front();
+                    tasks.pop_front();
+                    found = true;
+                }
+                pthread_mutex_unlock(&lock);
+                return found;
+            }
+        };
+
+        struct worker_argument
+        {
+            thread_pool *pool;
+            size_t      index;
+
+            worker_argument(thread_pool *owner, size_t id) : pool(owner), index(id) {}
+        };
+
+        queue                           *_queues;
+        size_t                          _count;
+        ft::vector<pthread_t>           _threads;
+        ft::vector<worker_argument>     _arguments;
+        pthread_mutex_t                 _idle_lock;
+        pthread_cond_t                  _idle;
+        bool                            _stopping;
+        size_t                          _sleeping;
+
+        thread_pool(const thread_pool &);
+        thread_pool &operator=(const thread_pool &);
+
+        bool    find_task(size_t home, task &work)
+        {
+            if (_queues[home].pop_back(work))
+                return true;
+            for (size_t i = 1; i < _count; ++i)
+                if (_queues[(home + i) % _count].steal(work))
+                    return true;
+            return false;
+        }
+
+        static void execute(task &work)
+        {
+            if (!ft::atomic_load(&work.batch->failed))
+            {
+                try
+                {
+                    work.function(work.context, work.first, work.last);
+                }
+                catch (...)
+                {
+                    int expected = 0;
+
+                    if (ft::atomic_compare_exchange(&work.batch->failed, expected, -1))
+                    {
+                        work.batch->error = std::current_exception();
+                        ft::atomic_store(&work.batch->failed, 1);
+                    }
+                }
+            }
+            ft::atomic_fetch_add(&work.batch->pending, -1L);
+        }
+
+        void    wake()
+        {
+            pthread_mutex_lock(&_idle_lock);
+            if (_sleeping)
+                pthread_cond_broadcast(&_idle);
+            pthread_mutex_unlock(&_idle_lock);
+        }
+
+        bool    has_work()
+        {
+            for (size_t i = 0; i < _count; ++i)
+            {
+                pthread_mutex_lock(&_queues[i].lock);
+                bool    empty = _queues[i].tasks.empty();
+                pthread_mutex_unlock(&_queues[i].lock);
+                if (!empty)
+                    return true;
+            }
+            return false;
+        }
+
+        void    run_worker(size_t index)
+        {
+            for (;;)
+            {
+                task    work;
+
+                if (find_task(index, work))
+                {
+                    execute(work);
+                    continue;
+                }
+                pthread_mutex_lock(&_idle_lock);
+                ++_sleeping;
+                while (!_stopping && !has_work())
+                    pthread_cond_wait(&_idle, &_idle_lock);
+                --_sleeping;
+                bool    stopping = _stopping;
+                pthread_mutex_unlock(&_idle_lock);
+                if (stopping)
+                    return;
+            }
+        }
+
+        static void *worker_main(void *argument)
+        {
+            worker_argument *worker = static_cast<worker_argument *>(argument);
+
+            worker->pool->run_worker(worker->index);
+            return 0;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <stdlib.h>
+#include "set/bitmap_set.hpp"
+#include "set/set.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+typedef ft::set<int>        tree_set;
+typedef ft::bitmap_set<int> compact_set;
+
+tree_set    unite(const tree_set &lhs, const tree_set &rhs)
+{
+    tree_set    result;
+
+    std::set_union(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(result, result.end()));
+    return result;
+}
+
+tree_set    intersect(const tree_set &lhs, const tree_set &rhs)
+{
+    tree_set    result;
+
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(result, result.end()));
+    return result;
+}
+
+tree_set    subtract(const tree_set &lhs, const tree_set &rhs)
+{
+    tree_set    result;
+
+    std::set_difference(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::inserter(result, result.end()));
+    return result;
+}
+
+compact_set unite(const compact_set &lhs, const compact_set &rhs)
+{
+    return lhs | rhs;
+}
+
+compact_set intersect(const compact_set &lhs, const compact_set &rhs)
+{
+    return lhs & rhs;
+}
+
+compact_set subtract(const compact_set &lhs, const compact_set &rhs)
+{
+    return lhs - rhs;
+}
+
+void    optimize(tree_set &) {}
+
+void    optimize(compact_set &set)
+{
+    set.optimize();
+}
+
+template <class Set>
+void    run(const char *name, const ft::vector<int> &left, const ft::vector<int> &right)
+{
+    Set     lhs;
+    Set     rhs;
+    size_t  checksum = 0;
+    double  start = bench::now();
+
+    for (size_t i = 0; i < left.size(); ++i)
+        lhs.insert(left[i]);
+    for (size_t i = 0; i < right.size(); ++i)
+        rhs.insert(right[i]);
+    optimize(lhs);
+    optimize(rhs);
+
+    double  build = bench::now() - start;
+
+    std::cout << "  " << name << ": " << (double)lhs.memory_usage().allocated_bytes / lhs.size()
+              << " bytes/element, build " << build * 1e3 << " ms";
+    start = bench::now();
+    for (size_t i = 0; i < right.size(); ++i)
+        checksum += lhs.count(right[i]);
+    std::cout << ", lookup " << (bench::now() - start) / right.size() * 1e9 << " ns";
+    start = bench::now();
+    checksum += unite(lhs, rhs).size();
+    std::cout << ", union " << (bench::now() - start) * 1e3 << " ms";
+    start = bench::now();
+    checksum += intersect(lhs, rhs).size();
+    std::cout << ", intersection " << (bench::now() - start) * 1e3 << " ms";
+    start = bench::now();
+    checksum += subtract(lhs, rhs).size();
+    std::cout << ", difference " << (bench::now() - start) * 1e3 << " ms (checksum " << checksum << ")" << std::endl;
+}
+
+void    dataset(const char *name, size_t count, long range)
+{
+    ft::vector<int> left;
+    ft::vector<int> right;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        left.push_back((int)(((long)rand() << 16 ^ rand()) % range));
+        right.push_back((int)(((long)rand() << 16 ^ rand()) % range));
+    }
+    std::cout << name << ": " << count << " keys per set in [0, " << range << ")" << std::endl;
+    run<tree_set>("ft::set       ", left, right);
+    run<compact_set>("ft::bitmap_set", left, right);
+}
+
+int main(int argc, char **argv)
+{
+    size_t  count = argc > 1 ? (size_t)strtod(argv[1], 0) : 1000000;
+
+    srand(1);
+    dataset("dense", count, (long)count * 2);
+    dataset("sparse", count, 1L << 31);
+    dataset("clustered", count, (long)count + count / 20);
+    return 0;
+}
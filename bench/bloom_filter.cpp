@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <string>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "set/set.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <class Container, class Key>
+double  lookups(const Container &container, const ft::vector<Key> &probes, long &checksum)
+{
+    double  start = bench::now();
+
+    for (size_t i = 0; i < probes.size(); ++i)
+        checksum += container.count(probes[i]);
+    return (bench::now() - start) / probes.size() * 1e9;
+}
+
+template <class Container, class Key>
+void    sweep(const char *name, Container &container, const ft::vector<Key> &keys, const ft::vector<Key> &misses)
+{
+    static const int    rates[] = { 0, 10, 50, 90, 100 };
+    ft::vector<Key>     probes;
+    long                checksum = 0;
+
+    std::printf("%s: %zu keys\n", name, keys.size());
+    for (size_t r = 0; r < sizeof(rates) / sizeof(rates[0]); ++r)
+    {
+        probes.clear();
+        for (size_t i = 0; i < misses.size(); ++i)
+            probes.push_back(rand() % 100 < rates[r] ? keys[rand() % keys.size()] : misses[i]);
+        container.disable_bloom_filter();
+
+        double  plain = lookups(container, probes, checksum);
+
+        container.enable_bloom_filter();
+
+        double  filtered = lookups(container, probes, checksum);
+
+        std::printf("  hit rate %3d%%  tree %6.0f ns  bloom %6.0f ns  speedup %5.2fx\n",
+                    rates[r], plain, filtered, plain / filtered);
+    }
+
+    ft::bloom_filter    filter;
+    size_t              false_positives = 0;
+
+    filter.reset(keys.size(), 10);
+    for (size_t i = 0; i < keys.size(); ++i)
+        filter.insert(ft::bloom_hash<Key>::hash(keys[i]));
+    for (size_t i = 0; i < misses.size(); ++i)
+        false_positives += filter.may_contain(ft::bloom_hash<Key>::hash(misses[i]));
+    std::printf("  filter %.1f bits/key, %.2f%% false positives  (%ld)\n",
+                (double)filter.memory() * 8 / keys.size(), 100.0 * false_positives / misses.size(), checksum);
+}
+
+int main(int argc, char **argv)
+{
+    size_t                      count = argc > 1 ? (size_t)strtod(argv[1], 0) : 1000000;
+    ft::vector<int>             ints;
+    ft::vector<int>             int_misses;
+    ft::vector<std::string>     ids;
+    ft::vector<std::string>     id_misses;
+    ft::map<int, int>           map;
+    ft::set<std::string>        set;
+    char                        buffer[64];
+
+    srand(1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ints.push_back(rand() & ~1);
+        int_misses.push_back(rand() | 1);
+        std::snprintf(buffer, sizeof(buffer), "user:%010zu", i * 2);
+        ids.push_back(buffer);
+        std::snprintf(buffer, sizeof(buffer), "user:%010zu", i * 2 + 1);
+        id_misses.push_back(buffer);
+    }
+    for (size_t i = 0; i < count; ++i)
+        map.insert(ft::make_pair(ints[i], (int)i));
+    for (size_t i = 0; i < count; ++i)
+        set.insert(ids[i]);
+    sweep("ft::map<int, int>", map, ints, int_misses);
+    sweep("ft::set<std::string>", set, ids, id_misses);
+    return 0;
+}
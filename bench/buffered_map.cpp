@@ -0,0 +1,66 @@
+#include <iostream>
+#include <stdlib.h>
+#include "buffered_map/buffered_map.hpp"
+#include "map/map.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+typedef ft::map<int, int>           map_type;
+typedef ft::buffered_map<int, int>  buffered_type;
+
+void    run(const ft::vector<int> &keys, size_t capacity)
+{
+    buffered_type   buffered(capacity);
+    long            sum = 0;
+    double          start = bench::now();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        buffered.insert(ft::make_pair(keys[i], (int)i));
+    buffered.flush();
+    double  insert = bench::now() - start;
+
+    for (size_t i = 0; i < capacity / 2; ++i)
+        buffered.insert(ft::make_pair(keys[i], (int)i));
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        sum += buffered.find(keys[keys.size() - 1 - i]) != 0;
+    double  find = bench::now() - start;
+    size_t  probes = 0;
+
+    while ((size_t)1 << probes <= buffered.buffer_size())
+        ++probes;
+    std::cout << "buffered capacity=" << capacity
+              << " insert: " << keys.size() / insert / 1e6 << " Mops/s"
+              << " find: " << keys.size() / find / 1e6 << " Mops/s"
+              << " buffer probes/find: " << probes
+              << (sum != (long)keys.size() ? " MISMATCH" : "") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t          size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 21;
+    ft::vector<int> keys;
+    map_type        map;
+    long            sum = 0;
+
+    srand(42);
+    for (size_t i = 0; i < size; ++i)
+        keys.push_back(rand());
+
+    double  start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.insert(ft::make_pair(keys[i], (int)i));
+    double  insert = bench::now() - start;
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        sum += map.find(keys[keys.size() - 1 - i]) != map.end();
+    double  find = bench::now() - start;
+
+    std::cout << "entries: " << size << std::endl;
+    std::cout << "map insert: " << size / insert / 1e6 << " Mops/s"
+              << " find: " << size / find / 1e6 << " Mops/s"
+              << (sum != (long)size ? " MISMATCH" : "") << std::endl;
+    for (size_t capacity = 32; capacity <= 2048; capacity *= 4)
+        run(keys, capacity);
+    return 0;
+}
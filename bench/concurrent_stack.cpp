@@ -0,0 +1,103 @@
+#include <iostream>
+#include <pthread.h>
+#include <stdlib.h>
+#include "stack/stack.hpp"
+#include "stack/concurrent_stack.hpp"
+#include "timer.hpp"
+
+struct locked_stack
+{
+    ft::stack<long>     stack;
+    pthread_mutex_t     lock;
+
+    locked_stack()
+    {
+        pthread_mutex_init(&lock, 0);
+    }
+
+    ~locked_stack()
+    {
+        pthread_mutex_destroy(&lock);
+    }
+
+    void    push(const long &value)
+    {
+        pthread_mutex_lock(&lock);
+        stack.push(value);
+        pthread_mutex_unlock(&lock);
+    }
+
+    bool    try_pop(long &out)
+    {
+        bool    result = false;
+
+        pthread_mutex_lock(&lock);
+        if (!stack.empty())
+        {
+            out = stack.top();
+            stack.pop();
+            result = true;
+        }
+        pthread_mutex_unlock(&lock);
+        return result;
+    }
+};
+
+template <class Stack>
+struct job
+{
+    Stack   *stack;
+    size_t  operations;
+    long    checksum;
+};
+
+template <class Stack>
+void    *worker(void *argument)
+{
+    job<Stack>  *work = static_cast<job<Stack> *>(argument);
+    long        value;
+
+    for (size_t i = 0; i < work->operations; ++i)
+    {
+        work->stack->push(i);
+        if (work->stack->try_pop(value))
+            work->checksum += value;
+    }
+    return 0;
+}
+
+template <class Stack>
+double  run(size_t threads, size_t operations)
+{
+    Stack               stack;
+    pthread_t           ids[64];
+    job<Stack>          jobs[64];
+    double              start = bench::now();
+
+    for (size_t i = 0; i < threads; ++i)
+    {
+        jobs[i].stack = &stack;
+        jobs[i].operations = operations / threads;
+        jobs[i].checksum = 0;
+        pthread_create(&ids[i], 0, worker<Stack>, &jobs[i]);
+    }
+    for (size_t i = 0; i < threads; ++i)
+        pthread_join(ids[i], 0);
+    return operations * 2 / (bench::now() - start) / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  operations = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 22;
+    size_t  max_threads = argc > 2 ? strtoul(argv[2], 0, 10) : 32;
+
+    if (max_threads > 64)
+        max_threads = 64;
+    std::cout << "push+pop pairs: " << operations << std::endl;
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+        std::cout << "threads=" << threads
+                  << " mutex ft::stack: " << run<locked_stack>(threads, operations) << " Mops/s"
+                  << " concurrent_stack: " << run<ft::concurrent_stack<long> >(threads, operations) << " Mops/s"
+                  << std::endl;
+    return 0;
+}
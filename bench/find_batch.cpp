@@ -0,0 +1,65 @@
+#include <iostream>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "set/set.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+typedef ft::map<int, int>   map_type;
+typedef ft::set<int>        set_type;
+
+template <class Container>
+void    run(const char *name, const Container &container, const ft::vector<int> &keys, size_t batch)
+{
+    typedef typename Container::const_iterator  const_iterator;
+
+    ft::vector<const_iterator>  out(batch);
+    long                        hits = 0;
+    double                      start = bench::now();
+
+    for (size_t i = 0; i + batch <= keys.size(); i += batch)
+        for (size_t j = 0; j < batch; ++j)
+            hits += container.find(keys[i + j]) != container.end();
+    double  loop = bench::now() - start;
+
+    start = bench::now();
+    for (size_t i = 0; i + batch <= keys.size(); i += batch)
+    {
+        container.find_batch(&keys[i], &keys[i] + batch, out.begin());
+        for (size_t j = 0; j < batch; ++j)
+            hits -= out[j] != container.end();
+    }
+    double  batched = bench::now() - start;
+
+    std::cout << name << " batch=" << batch
+              << " find: " << keys.size() / loop / 1e6 << " Mops/s"
+              << " find_batch: " << keys.size() / batched / 1e6 << " Mops/s"
+              << " speedup: " << loop / batched
+              << (hits ? " MISMATCH" : "") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 22;
+    size_t  lookups = argc > 2 ? strtoul(argv[2], 0, 10) : 1 << 20;
+    map_type    map;
+    set_type    set;
+    ft::vector<int> keys;
+
+    srand(42);
+    for (size_t i = 0; i < size; ++i)
+    {
+        int key = rand();
+        map.insert(ft::make_pair(key, key));
+        set.insert(key);
+    }
+    for (size_t i = 0; i < lookups; ++i)
+        keys.push_back(rand());
+    std::cout << "entries: " << size << " lookups: " << lookups << std::endl;
+    for (size_t batch = 64; batch <= 1024; batch *= 4)
+    {
+        run("map", map, keys, batch);
+        run("set", set, keys, batch);
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <iostream>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+typedef ft::map<int, int>   map_type;
+
+void    make_stream(const char *kind, size_t size, ft::vector<int> &keys)
+{
+    keys.clear();
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (kind[0] == 'm')
+            keys.push_back(i);
+        else if (kind[0] == 'n')
+            keys.push_back(i * 4 + rand() % 64);
+        else
+            keys.push_back(rand());
+    }
+}
+
+void    run(const char *kind, size_t size)
+{
+    ft::vector<int> keys;
+    long            sum = 0;
+
+    make_stream(kind, size, keys);
+
+    map_type    plain;
+    double      start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        plain.insert(ft::make_pair(keys[i], keys[i]));
+    double      plain_insert = bench::now() - start;
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        sum += plain.find(keys[i]) != plain.end();
+    double      plain_find = bench::now() - start;
+
+    map_type            fingered;
+    map_type::cursor    cursor(fingered);
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        cursor.insert(ft::make_pair(keys[i], keys[i]));
+    double      finger_insert = bench::now() - start;
+    cursor.reset();
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        sum -= cursor.find(keys[i]) != fingered.end();
+    double      finger_find = bench::now() - start;
+
+    std::cout << kind
+              << " insert: " << size / plain_insert / 1e6 << " -> " << size / finger_insert / 1e6 << " Mops/s"
+              << " find: " << size / plain_find / 1e6 << " -> " << size / finger_find / 1e6 << " Mops/s"
+              << (sum ? " MISMATCH" : "") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 21;
+
+    srand(42);
+    std::cout << "entries: " << size << " (map -> cursor)" << std::endl;
+    run("monotone", size);
+    run("nearly-monotone", size);
+    run("random", size);
+    return 0;
+}
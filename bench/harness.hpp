@@ -0,0 +1,520 @@
+#ifndef BENCH_HARNESS_HPP
+#define BENCH_HARNESS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <sys/resource.h>
+#include "perf_counters.hpp"
+#include "timer.hpp"
+
+namespace bench
+{
+    inline void consume(long value)
+    {
+        static volatile long    sink;
+
+        sink = sink + value;
+    }
+
+    class histogram
+    {
+    public:
+        enum { sub_bucket_bits = 5, sub_buckets = 1 << sub_bucket_bits };
+
+        histogram() : _counts((64 - sub_bucket_bits + 1) * sub_buckets, 0), _total(0), _max(0) {}
+
+        void        record(uint64_t value)
+        {
+            ++_counts[index(value)];
+            ++_total;
+            if (value > _max)
+                _max = value;
+        }
+
+        void        merge(const histogram &other)
+        {
+            for (size_t i = 0; i < _counts.size(); ++i)
+                _counts[i] += other._counts[i];
+            _total += other._total;
+            if (other._max > _max)
+                _max = other._max;
+        }
+
+        uint64_t    count() const
+        {
+            return _total;
+        }
+
+        uint64_t    max() const
+        {
+            return _max;
+        }
+
+        uint64_t    percentile(double rank) const
+        {
+            uint64_t    target = (uint64_t)std::ceil(rank * _total);
+            uint64_t    seen = 0;
+
+            if (!target)
+                target = 1;
+            for (size_t i = 0; i < _counts.size(); ++i)
+            {
+                seen += _counts[i];
+                if (seen >= target)
+                    return highest_equivalent(i) < _max ? highest_equivalent(i) : _max;
+            }
+            return _max;
+        }
+
+    private:
+        std::vector<uint64_t>   _counts;
+        uint64_t                _total;
+        uint64_t                _max;
+
+        static size_t   index(uint64_t value)
+        {
+            if (value < 2 * sub_buckets)
+                return (size_t)value;
+
+            int     shift = 63 - __builtin_clzll(value) - sub_bucket_bits;
+
+            return (size_t)((shift + 1) * sub_buckets + (value >> shift) - sub_buckets);
+        }
+
+        static uint64_t highest_equivalent(size_t index)
+        {
+            if (index < 2 * sub_buckets)
+                return index;
+
+            int     shift = (int)(index / sub_buckets) - 1;
+
+            return ((uint64_t)(index % sub_buckets + sub_buckets + 1) << shift) - 1;
+        }
+    };
+
+    struct probe
+    {
+        size_t  elements;
+        size_t  allocated_bytes;
+        size_t  rotations;
+        size_t  recolorings;
+        size_t  page_faults;
+        size_t  context_switches;
+    };
+
+    inline void read_process(probe &probe)
+    {
+        struct rusage   usage;
+
+        getrusage(RUSAGE_SELF, &usage);
+        probe.page_faults = usage.ru_minflt + usage.ru_majflt;
+        probe.context_switches = usage.ru_nvcsw + usage.ru_nivcsw;
+    }
+
+    struct event
+    {
+        size_t      index;
+        uint64_t    ns;
+        std::string cause;
+    };
+
+    inline std::string  describe(const probe &before, const probe &after)
+    {
+        std::ostringstream  cause;
+        const char          *separator = "";
+
+        if (after.allocated_bytes >= before.allocated_bytes + 4096)
+        {
+            cause << (before.allocated_bytes ? "reallocation of " : "allocation of ")
+                  << after.allocated_bytes << " bytes";
+            separator = ", ";
+        }
+        else if (before.allocated_bytes >= after.allocated_bytes + 4096)
+        {
+            cause << "release of " << before.allocated_bytes - after.allocated_bytes << " bytes";
+            separator = ", ";
+        }
+        if (after.rotations != before.rotations || after.recolorings != before.recolorings)
+        {
+            cause << separator << after.rotations - before.rotations << " rotations, "
+                  << after.recolorings - before.recolorings << " recolorings";
+            separator = ", ";
+        }
+        if (before.elements >= after.elements + 1024)
+        {
+            cause << separator << "destruction of " << before.elements - after.elements << " elements";
+            separator = ", ";
+        }
+        if (after.page_faults != before.page_faults)
+        {
+            cause << separator << after.page_faults - before.page_faults << " page faults";
+            separator = ", ";
+        }
+        if (after.context_switches != before.context_switches)
+            cause << separator << "context switch";
+        return cause.str();
+    }
+
+    struct result
+    {
+        std::string         container;
+        std::string         implementation;
+        std::string         operation;
+        std::string         distribution;
+        size_t              size;
+        size_t              value_size;
+        size_t              operations;
+        double              seconds;
+        std::vector<double> samples;
+        histogram           latency;
+        std::vector<event>  outliers;
+        std::vector<double> counters;
+        std::string         counters_error;
+    };
+
+    inline double   percentile(const std::vector<double> &sorted, double rank)
+    {
+        if (sorted.empty())
+            return 0;
+
+        size_t  index = (size_t)std::ceil(rank * sorted.size());
+
+        return sorted[index ? index - 1 : 0];
+    }
+
+    class report
+    {
+    public:
+        void    add(const result &entry)
+        {
+            _results.push_back(entry);
+        }
+
+        void    write_csv(std::ostream &out) const
+        {
+            out << "container,implementation,operation,distribution,size,value_size,operations,seconds,"
+                   "samples,median_ns,p90_ns,p99_ns,min_ns,max_ns,ops_per_sec,"
+                   "latency_p50_ns,latency_p99_ns,latency_p999_ns,latency_max_ns,outliers";
+            for (size_t i = 0; i < perf_counters::count; ++i)
+                out << ',' << perf_counters::name(i) << "_per_op";
+            out << '\n';
+            for (size_t i = 0; i < _results.size(); ++i)
+            {
+                const result        &entry = _results[i];
+                std::vector<double> sorted(entry.samples);
+
+                std::sort(sorted.begin(), sorted.end());
+                out << entry.container << ',' << entry.implementation << ',' << entry.operation << ','
+                    << entry.distribution << ',' << entry.size << ',' << entry.value_size << ','
+                    << entry.operations << ',' << entry.seconds << ',' << sorted.size() << ','
+                    << percentile(sorted, 0.5) << ',' << percentile(sorted, 0.9) << ','
+                    << percentile(sorted, 0.99) << ',' << percentile(sorted, 0) << ','
+                    << percentile(sorted, 1) << ',' << ops_per_sec(entry) << ','
+                    << entry.latency.percentile(0.5) << ',' << entry.latency.percentile(0.99) << ','
+                    << entry.latency.percentile(0.999) << ',' << entry.latency.max() << ','
+                    << entry.outliers.size();
+                for (size_t j = 0; j < perf_counters::count; ++j)
+                {
+                    out << ',';
+                    if (j < entry.counters.size() && entry.counters[j] >= 0)
+                        out << entry.counters[j];
+                }
+                out << '\n';
+            }
+        }
+
+        void    write_json(std::ostream &out) const
+        {
+            out << "{\n  \"results\": [";
+            for (size_t i = 0; i < _results.size(); ++i)
+            {
+                const result        &entry = _results[i];
+                std::vector<double> sorted(entry.samples);
+
+                std::sort(sorted.begin(), sorted.end());
+                out << (i ? ",\n" : "\n") << "    {"
+                    << "\"container\": \"" << entry.container << "\", "
+                    << "\"implementation\": \"" << entry.implementation << "\", "
+                    << "\"operation\": \"" << entry.operation << "\", "
+                    << "\"distribution\": \"" << entry.distribution << "\", "
+                    << "\"size\": " << entry.size << ", "
+                    << "\"value_size\": " << entry.value_size << ", "
+                    << "\"operations\": " << entry.operations << ", "
+                    << "\"seconds\": " << entry.seconds << ", "
+                    << "\"samples\": " << sorted.size() << ", "
+                    << "\"median_ns\": " << percentile(sorted, 0.5) << ", "
+                    << "\"p90_ns\": " << percentile(sorted, 0.9) << ", "
+                    << "\"p99_ns\": " << percentile(sorted, 0.99) << ", "
+                    << "\"min_ns\": " << percentile(sorted, 0) << ", "
+                    << "\"max_ns\": " << percentile(sorted, 1) << ", "
+                    << "\"ops_per_sec\": " << ops_per_sec(entry);
+                if (entry.latency.count())
+                {
+                    out << ", \"latency\": {"
+                        << "\"count\": " << entry.latency.count() << ", "
+                        << "\"p50_ns\": " << entry.latency.percentile(0.5) << ", "
+                        << "\"p99_ns\": " << entry.latency.percentile(0.99) << ", "
+                        << "\"p999_ns\": " << entry.latency.percentile(0.999) << ", "
+                        << "\"max_ns\": " << entry.latency.max() << ", "
+                        << "\"outliers\": [";
+                    for (size_t j = 0; j < entry.outliers.size(); ++j)
+                        out << (j ? ", " : "") << "{\"index\": " << entry.outliers[j].index
+                            << ", \"ns\": " << entry.outliers[j].ns
+                            << ", \"cause\": \"" << entry.outliers[j].cause << "\"}";
+                    out << "]}";
+                }
+                if (!entry.counters.empty())
+                {
+                    const char  *separator = "";
+
+                    out << ", \"counters\": {";
+                    for (size_t j = 0; j < entry.counters.size(); ++j)
+                    {
+                        if (entry.counters[j] < 0)
+                            continue;
+                        out << separator << "\"" << perf_counters::name(j) << "_per_op\": " << entry.counters[j];
+                        separator = ", ";
+                    }
+                    out << "}";
+                }
+                else if (!entry.counters_error.empty())
+                    out << ", \"counters\": {\"unavailable\": \"" << entry.counters_error << "\"}";
+                out << "}";
+            }
+            out << "\n  ]\n}\n";
+        }
+
+    private:
+        std::vector<result> _results;
+
+        static double   ops_per_sec(const result &entry)
+        {
+            return entry.seconds > 0 ? entry.operations / entry.seconds : 0;
+        }
+    };
+
+    class random
+    {
+    public:
+        explicit    random(uint64_t seed = 88172645463325252ULL) : _state(seed ? seed : 1) {}
+
+        uint64_t    next()
+        {
+            _state ^= _state << 13;
+            _state ^= _state >> 7;
+            _state ^= _state << 17;
+            return _state;
+        }
+
+        double      uniform()
+        {
+            return (next() >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+    private:
+        uint64_t    _state;
+    };
+
+    class zipf
+    {
+    public:
+        zipf(size_t items, double theta, uint64_t seed = 1) : _items(items), _theta(theta), _random(seed)
+        {
+            double  zeta2 = 1 + std::pow(0.5, theta);
+
+            _zetan = 0;
+            for (size_t i = 1; i <= items; ++i)
+                _zetan += 1 / std::pow((double)i, theta);
+            _alpha = 1 / (1 - theta);
+            _eta = (1 - std::pow(2.0 / items, 1 - theta)) / (1 - zeta2 / _zetan);
+        }
+
+        size_t  next()
+        {
+            double  u = _random.uniform();
+            double  uz = u * _zetan;
+
+            if (uz < 1)
+                return 0;
+            if (uz < 1 + std::pow(0.5, _theta))
+                return 1;
+
+            size_t  rank = (size_t)(_items * std::pow(_eta * u - _eta + 1, _alpha));
+
+            return rank < _items ? rank : _items - 1;
+        }
+
+    private:
+        size_t  _items;
+        double  _theta;
+        double  _zetan;
+        double  _alpha;
+        double  _eta;
+        random  _random;
+    };
+
+    inline std::vector<long>    make_keys(const std::string &distribution, size_t count, uint64_t seed = 1)
+    {
+        std::vector<long>   keys(count);
+        random              generator(seed);
+
+        if (distribution == "sequential")
+        {
+            for (size_t i = 0; i < count; ++i)
+                keys[i] = (long)i * 2;
+        }
+        else if (distribution == "zipf")
+        {
+            zipf    ranks(count, 0.99, seed);
+
+            for (size_t i = 0; i < count; ++i)
+                keys[i] = (long)((ranks.next() * 0x9e3779b97f4a7c15ULL) >> 2) & ~1L;
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+                keys[i] = (long)(generator.next() >> 2) & ~1L;
+        }
+        return keys;
+    }
+
+    inline size_t   batch_size(size_t operations)
+    {
+        size_t  batch = operations / 256;
+
+        if (batch < 16)
+            batch = 16;
+        if (batch > 65536)
+            batch = 65536;
+        return batch;
+    }
+
+    template <class Container>
+    struct operation
+    {
+        typedef void    (*setup_function)(Container &, const long *keys, size_t count);
+        typedef void    (*run_function)(Container &, const long *keys, size_t first, size_t last);
+
+        const char      *name;
+        setup_function  setup;
+        run_function    run;
+        bool            batched;
+        bool            keyed;
+    };
+
+    template <class Container>
+    void    measure(const operation<Container> &op, const std::vector<long> &keys, size_t repetitions,
+                    result &entry, perf_counters *counters = 0)
+    {
+        size_t  count = keys.size();
+        size_t  batch = op.batched ? batch_size(count) : count;
+
+        entry.operation = op.name;
+        entry.operations = 0;
+        entry.seconds = 0;
+        entry.samples.clear();
+        entry.counters.clear();
+        if (counters)
+            counters->reset();
+        for (size_t repetition = 0; repetition < repetitions; ++repetition)
+        {
+            Container   container;
+
+            op.setup(container, &keys[0], count);
+            for (size_t first = 0; first < count; first += batch)
+            {
+                size_t  last = first + batch < count ? first + batch : count;
+
+                if (counters)
+                    counters->start();
+
+                double  start = bench::now();
+
+                op.run(container, &keys[0], first, last);
+
+                double  elapsed = bench::now() - start;
+
+                if (counters)
+                    counters->stop();
+                entry.seconds += elapsed;
+                entry.samples.push_back(elapsed * 1e9 / (last - first));
+            }
+            entry.operations += count;
+        }
+        if (counters && counters->available())
+        {
+            for (size_t i = 0; i < perf_counters::count; ++i)
+                entry.counters.push_back(counters->available(i) ? counters->total(i) / entry.operations : -1);
+        }
+        else if (counters)
+            entry.counters_error = counters->error();
+    }
+
+    inline bool slower(const event &lhs, const event &rhs)
+    {
+        return lhs.ns > rhs.ns;
+    }
+
+    template <class Container>
+    void    measure_latency(const operation<Container> &op, probe (*inspect)(const Container &),
+                            const std::vector<long> &keys, size_t repetitions, size_t outliers, result &entry)
+    {
+        size_t              count = keys.size();
+        size_t              step = op.batched ? 1 : count;
+        double              rate = ticks_per_ns();
+        std::vector<event>  slowest;
+
+        entry.operation = op.name;
+        entry.operations = 0;
+        entry.seconds = 0;
+        entry.samples.clear();
+        entry.latency = histogram();
+        for (size_t repetition = 0; repetition < repetitions; ++repetition)
+        {
+            Container   container;
+
+            op.setup(container, &keys[0], count);
+            for (size_t first = 0; first < count; first += step)
+            {
+                probe       before = inspect(container);
+                uint64_t    start = ticks();
+
+                op.run(container, &keys[0], first, first + step);
+
+                uint64_t    ns = (uint64_t)((ticks() - start) / rate);
+                probe       after = inspect(container);
+
+                entry.seconds += ns * 1e-9;
+                entry.latency.record(ns);
+                if (outliers && (slowest.size() < outliers || ns > slowest.front().ns))
+                {
+                    event   slow = {first, ns, describe(before, after)};
+
+                    if (slowest.size() == outliers)
+                    {
+                        std::pop_heap(slowest.begin(), slowest.end(), slower);
+                        slowest.pop_back();
+                    }
+                    slowest.push_back(slow);
+                    std::push_heap(slowest.begin(), slowest.end(), slower);
+                }
+            }
+            entry.operations += count;
+        }
+
+        uint64_t    threshold = entry.latency.percentile(0.999);
+
+        std::sort(slowest.begin(), slowest.end(), slower);
+        entry.outliers.clear();
+        for (size_t i = 0; i < slowest.size(); ++i)
+            if (!op.batched || slowest[i].ns > threshold)
+                entry.outliers.push_back(slowest[i]);
+    }
+}
+
+#endif
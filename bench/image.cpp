@@ -0,0 +1,72 @@
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "map/map_view.hpp"
+#include "harness.hpp"
+
+template <class Map>
+long    lookup(const Map &map, const std::vector<long> &keys)
+{
+    long    found = 0;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        found += map.find(keys[i]) != map.end();
+    return found;
+}
+
+int main(int argc, char **argv)
+{
+    size_t              size = argc > 1 ? (size_t)strtod(argv[1], 0) : 10000000;
+    const char          *path = argc > 2 ? argv[2] : "bench/map.img";
+    std::vector<long>   keys = bench::make_keys("uniform", size);
+    std::vector<long>   probes(keys.begin(), keys.begin() + (size < 1000000 ? size : 1000000));
+    double              start = bench::now();
+    long                found;
+
+    {
+        ft::map<long, long> map;
+
+        for (size_t i = 0; i < size; ++i)
+            map.insert(ft::make_pair(keys[i], (long)i));
+
+        double  rebuild = bench::now() - start;
+
+        start = bench::now();
+        found = lookup(map, probes);
+
+        double  tree_find = bench::now() - start;
+
+        start = bench::now();
+        map.save(path);
+
+        double  save = bench::now() - start;
+
+        std::cout << "entries " << size << std::endl
+                  << "rebuild: " << rebuild << " s" << std::endl
+                  << "save: " << save << " s" << std::endl
+                  << "map find: " << probes.size() / tree_find / 1e6 << " Mops/s" << std::endl;
+    }
+    start = bench::now();
+
+    ft::map_view<long, long>    view(path);
+    double                      open = bench::now() - start;
+
+    start = bench::now();
+    bench::consume(view.find(keys[0])->second);
+
+    double  first = bench::now() - start;
+
+    start = bench::now();
+
+    long    view_found = lookup(view, probes);
+    double  view_find = bench::now() - start;
+
+    std::cout << "open: " << open << " s" << std::endl
+              << "first find after open: " << first * 1e6 << " us" << std::endl
+              << "view find: " << probes.size() / view_find / 1e6 << " Mops/s"
+              << (view_found != found ? " MISMATCH" : "") << std::endl;
+    view.close();
+    remove(path);
+    return 0;
+}
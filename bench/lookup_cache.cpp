@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+ft::vector<size_t>  zipf_ranks(size_t keys, size_t draws, double skew)
+{
+    ft::vector<double>  cdf(keys);
+    ft::vector<size_t>  ranks;
+    double              sum = 0;
+
+    for (size_t i = 0; i < keys; ++i)
+        cdf[i] = sum += 1.0 / std::pow((double)(i + 1), skew);
+    for (size_t i = 0; i < draws; ++i)
+    {
+        double  target = (double)rand() / RAND_MAX * sum;
+
+        ranks.push_back(std::lower_bound(&cdf[0], &cdf[0] + keys, target) - &cdf[0]);
+    }
+    return ranks;
+}
+
+template <class Map, class Key>
+double  lookups(Map &map, const ft::vector<Key> &probes, long &checksum)
+{
+    double  start = bench::now();
+
+    for (size_t i = 0; i < probes.size(); ++i)
+        checksum += map.find(probes[i])->second;
+    return (bench::now() - start) / probes.size() * 1e9;
+}
+
+template <class Key>
+void    sweep(const char *name, const ft::vector<Key> &keys, const ft::vector<size_t> &ranks)
+{
+    static const size_t     capacities[] = { 1024, 4096, 16384, 65536 };
+    ft::map<Key, int>       map;
+    ft::vector<Key>         probes;
+    long                    checksum = 0;
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.insert(ft::make_pair(keys[i], (int)i));
+    for (size_t i = 0; i < ranks.size(); ++i)
+        probes.push_back(keys[ranks[i]]);
+    std::printf("%s: %zu keys, %zu zipf(0.99) finds\n", name, keys.size(), probes.size());
+
+    double  plain = lookups(map, probes, checksum);
+
+    std::printf("  tree                 %6.0f ns/find\n", plain);
+    for (size_t c = 0; c < sizeof(capacities) / sizeof(capacities[0]); ++c)
+    {
+        map.enable_lookup_cache(capacities[c]);
+        lookups(map, probes, checksum);
+
+        double  cached = lookups(map, probes, checksum);
+
+        std::printf("  cache %6zu entries  %6.0f ns/find  speedup %5.2fx  (%ld)\n",
+                    capacities[c], cached, plain / cached, checksum);
+        map.disable_lookup_cache();
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t                      count = argc > 1 ? (size_t)strtod(argv[1], 0) : 1000000;
+    size_t                      draws = argc > 2 ? (size_t)strtod(argv[2], 0) : 2000000;
+    ft::vector<size_t>          ranks;
+    ft::vector<int>             ints;
+    ft::vector<std::string>     ids;
+    char                        buffer[64];
+
+    srand(1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        ints.push_back((int)i);
+        std::snprintf(buffer, sizeof(buffer), "user:%010zu", i);
+        ids.push_back(buffer);
+    }
+    std::random_shuffle(&ints[0], &ints[0] + count);
+    std::random_shuffle(&ids[0], &ids[0] + count);
+    ranks = zipf_ranks(count, draws, 0.99);
+    sweep("ft::map<int, int>", ints, ranks);
+    sweep("ft::map<std::string, int>", ids, ranks);
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "vector/mapped_vector.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <class Vector>
+void    run(const char *name, Vector &vector, size_t fill_count, const std::vector<long> &probes)
+{
+    double  start = bench::now();
+    long    sum = 0;
+
+    for (size_t i = 0; i < fill_count; ++i)
+        vector.push_back((long)i);
+
+    double  fill = bench::now() - start;
+    size_t  count = vector.size();
+
+    start = bench::now();
+    for (size_t i = 0; i < count; ++i)
+        sum += vector[i];
+
+    double  sequential = bench::now() - start;
+
+    start = bench::now();
+    for (size_t i = 0; i < probes.size(); ++i)
+        sum += vector[(size_t)probes[i] % count];
+
+    double  random = bench::now() - start;
+
+    bench::consume(sum);
+    std::cout << name << ": ";
+    if (fill_count)
+        std::cout << "fill " << fill_count * sizeof(long) / fill / 1e6 << " MB/s, ";
+    std::cout << "sequential read "
+              << count * sizeof(long) / sequential / 1e6 << " MB/s, random read "
+              << probes.size() / random / 1e6 << " Mops/s" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t              ram = (size_t)sysconf(_SC_PHYS_PAGES) * (size_t)sysconf(_SC_PAGESIZE);
+    size_t              bytes = argc > 1 ? (size_t)strtod(argv[1], 0) : 2 * ram;
+    const char          *path = argc > 2 ? argv[2] : "bench/mapped_vector.bin";
+    size_t              count = bytes / sizeof(long);
+    std::vector<long>   probes = bench::make_keys("uniform", 1000000);
+
+    std::cout << "elements " << count << " (" << bytes / 1e9 << " GB, RAM " << ram / 1e9 << " GB)" << std::endl;
+    {
+        ft::mapped_vector<long> vector(path);
+
+        vector.clear();
+        vector.advise(ft::mapped_vector<long>::sequential);
+        run("mapped_vector", vector, count, probes);
+        vector.advise(ft::mapped_vector<long>::random);
+        run("mapped_vector (random advice)", vector, 0, probes);
+        vector.flush();
+    }
+    remove(path);
+    if (bytes > ram / 2)
+        std::cout << "vector: skipped, " << bytes / 1e9 << " GB does not fit in memory" << std::endl;
+    else
+    {
+        ft::vector<long>    vector;
+
+        run("vector", vector, count, probes);
+    }
+    return 0;
+}
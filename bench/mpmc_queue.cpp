@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <iostream>
+#include <pthread.h>
+#include <stdlib.h>
+#include "queue/mpmc_queue.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+struct message
+{
+    double  sent;
+    long    payload;
+};
+
+template <class Queue>
+struct context
+{
+    Queue               *queue;
+    size_t              items;
+    ft::vector<double>  latencies;
+};
+
+template <class Queue>
+void    *producer(void *argument)
+{
+    context<Queue>  *ctx = static_cast<context<Queue> *>(argument);
+    message         item;
+
+    for (size_t i = 0; i < ctx->items; ++i)
+    {
+        item.sent = bench::now();
+        item.payload = i;
+        ctx->queue->push(item);
+    }
+    return 0;
+}
+
+template <class Queue>
+void    *consumer(void *argument)
+{
+    context<Queue>  *ctx = static_cast<context<Queue> *>(argument);
+    message         item;
+
+    for (size_t i = 0; i < ctx->items; ++i)
+    {
+        ctx->queue->pop(item);
+        if (!(i & 15))
+            ctx->latencies.push_back(bench::now() - item.sent);
+    }
+    return 0;
+}
+
+double  percentile(const ft::vector<double> &sorted, double rank)
+{
+    if (sorted.empty())
+        return 0;
+    return sorted[(size_t)(rank * (sorted.size() - 1))] * 1e6;
+}
+
+template <class Queue>
+void    run(const char *name, size_t pairs, size_t items, size_t capacity)
+{
+    Queue                   queue(capacity);
+    pthread_t               ids[128];
+    context<Queue>          contexts[128];
+    ft::vector<double>      latencies;
+    double                  start = bench::now();
+
+    for (size_t i = 0; i < 2 * pairs; ++i)
+    {
+        contexts[i].queue = &queue;
+        contexts[i].items = items / pairs;
+        pthread_create(&ids[i], 0, i < pairs ? producer<Queue> : consumer<Queue>, &contexts[i]);
+    }
+    for (size_t i = 0; i < 2 * pairs; ++i)
+        pthread_join(ids[i], 0);
+
+    double  elapsed = bench::now() - start;
+
+    for (size_t i = pairs; i < 2 * pairs; ++i)
+        for (size_t j = 0; j < contexts[i].latencies.size(); ++j)
+            latencies.push_back(contexts[i].latencies[j]);
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name << " " << pairs << "P/" << pairs << "C"
+              << " throughput: " << (items / pairs * pairs) / elapsed / 1e6 << " Mops/s"
+              << " latency us p50: " << percentile(latencies, 0.5)
+              << " p99: " << percentile(latencies, 0.99)
+              << " p99.9: " << percentile(latencies, 0.999)
+              << " max: " << percentile(latencies, 1.0) << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  items = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 22;
+    size_t  capacity = argc > 2 ? strtoul(argv[2], 0, 10) : 1024;
+
+    std::cout << "items: " << items << " capacity: " << capacity << std::endl;
+    run<ft::spsc_queue<message> >("spsc", 1, items, capacity);
+    run<ft::mpmc_queue<message> >("mpmc", 1, items, capacity);
+    run<ft::mpmc_queue<message> >("mpmc", 4, items, capacity);
+    run<ft::mpmc_queue<message> >("mpmc", 16, items, capacity);
+    return 0;
+}
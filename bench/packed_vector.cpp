@@ -0,0 +1,82 @@
+#include <iostream>
+#include <stdlib.h>
+#include "vector/packed_vector.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <class T>
+void    run(const char *name, const ft::vector<T> &values, int reps)
+{
+    ft::packed_vector<T>    packed;
+    ft::vector<T>           out(values.size());
+    size_t                  count = values.size();
+    long                    checksum = 0;
+
+    for (size_t i = 0; i < count; ++i)
+        packed.push_back(values[i]);
+    packed.shrink_to_fit();
+    std::cout << name << ": " << packed.bits_per_value() << " bits per integer (raw "
+              << sizeof(T) * 8 << ")" << std::endl;
+
+    double  start = bench::now();
+
+    for (int r = 0; r < reps; ++r)
+        for (size_t i = 0; i < count; ++i)
+            checksum += values[i];
+
+    double  elapsed = bench::now() - start;
+
+    std::cout << "  vector scan        " << count * reps / elapsed / 1e6 << " M ints/s" << std::endl;
+    start = bench::now();
+    for (int r = 0; r < reps; ++r)
+        for (typename ft::packed_vector<T>::const_iterator it = packed.begin(); it != packed.end(); ++it)
+            checksum += *it;
+    elapsed = bench::now() - start;
+    std::cout << "  iterator decode    " << count * reps / elapsed / 1e6 << " M ints/s" << std::endl;
+    start = bench::now();
+    for (int r = 0; r < reps; ++r)
+        for (typename ft::packed_vector<T>::const_iterator it = packed.begin(); it != packed.end();)
+            checksum += *it++;
+    elapsed = bench::now() - start;
+    std::cout << "  iterator *it++     " << count * reps / elapsed / 1e6 << " M ints/s" << std::endl;
+    start = bench::now();
+    for (int r = 0; r < reps; ++r)
+    {
+        packed.copy(&out[0]);
+        checksum += out[r % count];
+    }
+    elapsed = bench::now() - start;
+    std::cout << "  block decode       " << count * reps / elapsed / 1e6 << " M ints/s" << std::endl;
+    srand(7);
+    start = bench::now();
+    for (size_t i = 0; i < count; ++i)
+        checksum += packed[(size_t)rand() % count];
+    elapsed = bench::now() - start;
+    std::cout << "  random access      " << elapsed / count * 1e9 << " ns/op" << std::endl;
+    std::cout << "  checksum " << checksum << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t              count = argc > 1 ? (size_t)strtod(argv[1], 0) : 10000000;
+    int                 reps = argc > 2 ? atoi(argv[2]) : 5;
+    ft::vector<int>     sorted_ints;
+    ft::vector<int>     random_ints;
+    ft::vector<long>    sorted_longs;
+    int                 id = 0;
+    long                long_id = 1L << 40;
+
+    srand(1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        id += rand() % 16;
+        long_id += rand() % 256;
+        sorted_ints.push_back(id);
+        random_ints.push_back(rand());
+        sorted_longs.push_back(long_id);
+    }
+    run("sorted int, gaps < 16", sorted_ints, reps);
+    run("random int", random_ints, reps);
+    run("sorted long, gaps < 256", sorted_longs, reps);
+    return 0;
+}
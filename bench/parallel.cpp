@@ -0,0 +1,84 @@
+#include <iostream>
+#include <stdlib.h>
+#include "algorithm/parallel.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+struct scale
+{
+    void    operator()(long &value) const
+    {
+        value = value * 3 + 1;
+    }
+};
+
+struct square
+{
+    long    operator()(long value) const
+    {
+        return value * value;
+    }
+};
+
+struct is_odd
+{
+    bool    operator()(long value) const
+    {
+        return value & 1;
+    }
+};
+
+template <class Policy>
+void    run(const Policy &policy, size_t threads, ft::vector<long> &data, ft::vector<long> &out, double *baseline)
+{
+    double  times[4];
+    double  start = bench::now();
+
+    ft::for_each(policy, data.begin(), data.end(), scale());
+    times[0] = bench::now() - start;
+    start = bench::now();
+    ft::transform(policy, data.begin(), data.end(), out.begin(), square());
+    times[1] = bench::now() - start;
+    start = bench::now();
+    long    sum = ft::reduce(policy, out.begin(), out.end(), 0L);
+    times[2] = bench::now() - start;
+    start = bench::now();
+    long    odd = ft::count_if(policy, data.begin(), data.end(), is_odd());
+    times[3] = bench::now() - start;
+
+    const char  *names[4] = {"for_each", "transform", "reduce", "count_if"};
+
+    std::cout << "threads=" << threads;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        if (!baseline[i])
+            baseline[i] = times[i];
+        std::cout << " " << names[i] << ": " << times[i] * 1e3 << " ms (x" << baseline[i] / times[i] << ")";
+    }
+    std::cout << " [" << (sum ^ odd) << "]" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t              size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 25;
+    size_t              max_threads = argc > 2 ? strtoul(argv[2], 0, 10) : ft::thread_pool::hardware_threads();
+    ft::vector<long>    data(size, 1);
+    ft::vector<long>    out(size, 0);
+    double              baseline[4] = {0, 0, 0, 0};
+
+    std::cout << "elements: " << size << std::endl;
+    run(ft::execution::seq, 0, data, out, baseline);
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ft::thread_pool pool(threads);
+
+        run(ft::execution::parallel_policy(pool), threads, data, out, baseline);
+        if (threads * 2 > max_threads && threads != max_threads)
+        {
+            ft::thread_pool last(max_threads);
+
+            run(ft::execution::parallel_policy(last), max_threads, data, out, baseline);
+        }
+    }
+    return 0;
+}
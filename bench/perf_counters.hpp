@@ -0,0 +1,170 @@
+#ifndef BENCH_PERF_COUNTERS_HPP
+#define BENCH_PERF_COUNTERS_HPP
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <stdint.h>
+#include <unistd.h>
+#ifdef __linux__
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+#endif
+
+namespace bench
+{
+    class perf_counters
+    {
+    public:
+        enum { cycles, instructions, cache_misses, l1d_misses, dtlb_misses, branch_misses, page_faults, count };
+
+        perf_counters() : _open(0)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                _totals[i] = 0;
+                _fds[i] = open_event(i);
+                _open += _fds[i] >= 0;
+            }
+        }
+
+        ~perf_counters()
+        {
+            for (size_t i = 0; i < count; ++i)
+                if (_fds[i] >= 0)
+                    close(_fds[i]);
+        }
+
+        static const char   *name(size_t counter)
+        {
+            static const char   *names[count] = {
+                "cycles", "instructions", "cache_misses", "l1d_misses", "dtlb_misses", "branch_misses",
+                "page_faults"
+            };
+
+            return names[counter];
+        }
+
+        bool                available() const
+        {
+            return _open != 0;
+        }
+
+        bool                available(size_t counter) const
+        {
+            return _fds[counter] >= 0;
+        }
+
+        const std::string   &error() const
+        {
+            return _error;
+        }
+
+        double              total(size_t counter) const
+        {
+            return _totals[counter];
+        }
+
+        void                reset()
+        {
+            for (size_t i = 0; i < count; ++i)
+                _totals[i] = 0;
+        }
+
+        void                start()
+        {
+#ifdef __linux__
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (_fds[i] < 0)
+                    continue;
+                ioctl(_fds[i], PERF_EVENT_IOC_RESET, 0);
+                ioctl(_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        }
+
+        void                stop()
+        {
+#ifdef __linux__
+            for (size_t i = 0; i < count; ++i)
+                if (_fds[i] >= 0)
+                    ioctl(_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            for (size_t i = 0; i < count; ++i)
+            {
+                uint64_t    reading[3];
+
+                if (_fds[i] < 0 || read(_fds[i], reading, sizeof(reading)) != sizeof(reading) || !reading[2])
+                    continue;
+                _totals[i] += (double)reading[0] * reading[1] / reading[2];
+            }
+#endif
+        }
+
+    private:
+        int         _fds[count];
+        double      _totals[count];
+        size_t      _open;
+        std::string _error;
+
+        perf_counters(const perf_counters &);
+        perf_counters   &operator=(const perf_counters &);
+
+        int     open_event(size_t counter)
+        {
+#ifdef __linux__
+            struct perf_event_attr  attr;
+
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            switch (counter)
+            {
+                case cycles:
+                    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                    break;
+                case instructions:
+                    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                    break;
+                case cache_misses:
+                    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                    break;
+                case l1d_misses:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                    break;
+                case dtlb_misses:
+                    attr.type = PERF_TYPE_HW_CACHE;
+                    attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                  | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                    break;
+                case branch_misses:
+                    attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                    break;
+                default:
+                    attr.type = PERF_TYPE_SOFTWARE;
+                    attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+                    break;
+            }
+
+            int     fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+            if (fd < 0 && _error.empty())
+                _error = std::string(name(counter)) + ": " + std::strerror(errno);
+            return fd;
+#else
+            if (_error.empty())
+                _error = std::string(name(counter)) + ": perf_event_open is not available";
+            return -1;
+#endif
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "map/map.hpp"
+#include "map/radix_map.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+size_t  resident_bytes()
+{
+    std::ifstream   statm("/proc/self/statm");
+    size_t          pages = 0;
+    size_t          resident = 0;
+
+    statm >> pages >> resident;
+    return resident * (size_t)sysconf(_SC_PAGESIZE);
+}
+
+template <class Map>
+long    scan(const Map &map)
+{
+    long    checksum = 0;
+
+    for (typename Map::const_iterator it = map.begin(); it != map.end(); ++it)
+        checksum += it->second;
+    return checksum;
+}
+
+template <class Map, class Key>
+void    run(const char *name, const ft::vector<Key> &keys, const ft::vector<Key> &misses)
+{
+    size_t  baseline = resident_bytes();
+    long    checksum = 0;
+    Map     map;
+    double  start = bench::now();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+        map.insert(typename Map::value_type(keys[i], (int)i));
+
+    double  insert = bench::now() - start;
+    size_t  memory = resident_bytes() - baseline;
+
+    start = bench::now();
+    for (size_t i = 0; i < keys.size(); ++i)
+        checksum += map.find(keys[i])->second;
+
+    double  hit = bench::now() - start;
+
+    start = bench::now();
+    for (size_t i = 0; i < misses.size(); ++i)
+        checksum += map.count(misses[i]);
+
+    double  miss = bench::now() - start;
+
+    start = bench::now();
+    checksum += scan(map);
+
+    double  ordered = bench::now() - start;
+
+    std::printf("  %-22s %7.1f bytes/key  insert %6.0f ns  hit %6.0f ns  miss %6.0f ns  scan %6.1f ns  (%ld)\n",
+                name, (double)memory / keys.size(), insert / keys.size() * 1e9, hit / keys.size() * 1e9,
+                miss / misses.size() * 1e9, ordered / keys.size() * 1e9, checksum);
+}
+
+template <class Map, class Key>
+void    isolated(const char *name, const ft::vector<Key> &keys, const ft::vector<Key> &misses)
+{
+    std::cout.flush();
+
+    pid_t   pid = fork();
+
+    if (pid == 0)
+    {
+        run<Map>(name, keys, misses);
+        std::fflush(stdout);
+        _exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, 0, 0);
+}
+
+template <class Key>
+void    compare(const char *workload, const ft::vector<Key> &keys, const ft::vector<Key> &misses)
+{
+    std::printf("%s: %zu keys\n", workload, keys.size());
+    std::fflush(stdout);
+    isolated<ft::map<Key, int> >("ft::map", keys, misses);
+    isolated<ft::radix_map<Key, int> >("ft::radix_map", keys, misses);
+    isolated<std::unordered_map<Key, int> >("std::unordered_map", keys, misses);
+}
+
+std::string random_word(size_t length)
+{
+    std::string word;
+
+    for (size_t i = 0; i < length; ++i)
+        word.push_back((char)('a' + rand() % 26));
+    return word;
+}
+
+int main(int argc, char **argv)
+{
+    size_t                  count = argc > 1 ? (size_t)strtod(argv[1], 0) : 1000000;
+    ft::vector<long>        longs;
+    ft::vector<long>        long_misses;
+    ft::vector<int>         ints;
+    ft::vector<int>         int_misses;
+    ft::vector<std::string> ids;
+    ft::vector<std::string> id_misses;
+    ft::vector<std::string> urls;
+    ft::vector<std::string> url_misses;
+    char                    buffer[64];
+
+    srand(1);
+    for (size_t i = 0; i < count; ++i)
+    {
+        longs.push_back((long)rand() << 32 ^ rand());
+        long_misses.push_back((long)rand() << 32 ^ rand());
+        ints.push_back(rand() - RAND_MAX / 2);
+        int_misses.push_back(rand() - RAND_MAX / 2);
+        std::snprintf(buffer, sizeof(buffer), "user:%010zu", i * 2);
+        ids.push_back(buffer);
+        std::snprintf(buffer, sizeof(buffer), "user:%010zu", i * 2 + 1);
+        id_misses.push_back(buffer);
+        urls.push_back("https://example.com/" + random_word(4) + "/" + random_word(6 + rand() % 10));
+        url_misses.push_back("https://example.com/" + random_word(4) + "/" + random_word(6 + rand() % 10));
+    }
+    std::random_shuffle(&ids[0], &ids[0] + count);
+    compare("random long", longs, long_misses);
+    compare("random signed int", ints, int_misses);
+    compare("string ids", ids, id_misses);
+    compare("urls", urls, url_misses);
+    return 0;
+}
@@ -0,0 +1,433 @@
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include "buffered_map/buffered_map.hpp"
+#include "map/map.hpp"
+#include "set/set.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+#include "trace.hpp"
+
+template <class Map>
+struct map_backend
+{
+    typedef Map container_type;
+
+    static bool apply(Map &map, const bench::trace_record &record)
+    {
+        switch (record.operation)
+        {
+            case bench::trace_insert:
+                map.insert(typename Map::value_type(record.key, std::string(record.value_size, 'v')));
+                return true;
+            case bench::trace_find:
+                bench::consume(map.find(record.key) != map.end());
+                return true;
+            case bench::trace_erase:
+                map.erase(record.key);
+                return true;
+            case bench::trace_lower_bound:
+                bench::consume(map.lower_bound(record.key) != map.end());
+                return true;
+            case bench::trace_clear:
+                map.clear();
+                return true;
+        }
+        return false;
+    }
+};
+
+template <class Set>
+struct set_backend
+{
+    typedef Set container_type;
+
+    static bool apply(Set &set, const bench::trace_record &record)
+    {
+        switch (record.operation)
+        {
+            case bench::trace_insert:
+                set.insert(record.key);
+                return true;
+            case bench::trace_find:
+                bench::consume(set.find(record.key) != set.end());
+                return true;
+            case bench::trace_erase:
+                set.erase(record.key);
+                return true;
+            case bench::trace_lower_bound:
+                bench::consume(set.lower_bound(record.key) != set.end());
+                return true;
+            case bench::trace_clear:
+                set.clear();
+                return true;
+        }
+        return false;
+    }
+};
+
+struct buffered_map_backend
+{
+    typedef ft::buffered_map<long, std::string> container_type;
+
+    static bool apply(container_type &map, const bench::trace_record &record)
+    {
+        switch (record.operation)
+        {
+            case bench::trace_insert:
+                map.insert(container_type::value_type(record.key, std::string(record.value_size, 'v')));
+                return true;
+            case bench::trace_find:
+                bench::consume(map.find(record.key) != 0);
+                return true;
+            case bench::trace_erase:
+                map.erase(record.key);
+                return true;
+            case bench::trace_clear:
+                map.clear();
+                return true;
+        }
+        return false;
+    }
+};
+
+template <class Vector>
+struct sorted_vector_backend
+{
+    typedef Vector                          container_type;
+    typedef typename Vector::value_type     value_type;
+    typedef typename Vector::iterator       iterator;
+
+    static bool     key_less(const value_type &entry, long key)
+    {
+        return entry.first < key;
+    }
+
+    static iterator lower_bound(Vector &vector, long key)
+    {
+        return std::lower_bound(vector.begin(), vector.end(), key, key_less);
+    }
+
+    static bool apply(Vector &vector, const bench::trace_record &record)
+    {
+        iterator    it;
+
+        switch (record.operation)
+        {
+            case bench::trace_insert:
+                it = lower_bound(vector, record.key);
+                if (it == vector.end() || it->first != record.key)
+                    vector.insert(it, value_type(record.key, std::string(record.value_size, 'v')));
+                return true;
+            case bench::trace_find:
+                it = lower_bound(vector, record.key);
+                bench::consume(it != vector.end() && it->first == record.key);
+                return true;
+            case bench::trace_erase:
+                it = lower_bound(vector, record.key);
+                if (it != vector.end() && it->first == record.key)
+                    vector.erase(it);
+                return true;
+            case bench::trace_lower_bound:
+                bench::consume(lower_bound(vector, record.key) != vector.end());
+                return true;
+            case bench::trace_clear:
+                vector.clear();
+                return true;
+        }
+        return false;
+    }
+};
+
+template <class Vector>
+struct sequence_backend
+{
+    typedef Vector container_type;
+
+    static bool apply(Vector &vector, const bench::trace_record &record)
+    {
+        switch (record.operation)
+        {
+            case bench::trace_push_back:
+                vector.push_back(std::string(record.value_size, 'v'));
+                return true;
+            case bench::trace_pop_back:
+                if (!vector.empty())
+                    vector.pop_back();
+                return true;
+            case bench::trace_read:
+                if (!vector.empty())
+                    bench::consume(vector[(size_t)record.key % vector.size()].size());
+                return true;
+            case bench::trace_clear:
+                vector.clear();
+                return true;
+        }
+        return false;
+    }
+};
+
+struct config
+{
+    std::string                 trace;
+    std::string                 record;
+    std::string                 workload;
+    std::string                 distribution;
+    size_t                      count;
+    std::vector<std::string>    backends;
+    bool                        latency;
+    std::string                 json;
+    std::string                 csv;
+};
+
+std::vector<std::string>    split(const std::string &list)
+{
+    std::vector<std::string>    items;
+    std::stringstream           stream(list);
+    std::string                 item;
+
+    while (std::getline(stream, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+bool    selected(const std::vector<std::string> &filter, const std::string &name)
+{
+    return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+}
+
+size_t  record_trace(const config &settings)
+{
+    bench::trace_writer     trace(settings.record.c_str());
+    std::vector<long>       keys = bench::make_keys(settings.distribution, settings.count);
+    bench::random           random(7);
+    static const size_t     value_sizes[] = {8, 32, 128, 512};
+
+    if (!trace.good())
+        return 0;
+    if (settings.workload == "vector")
+    {
+        ft::vector<std::string>                         vector;
+        bench::traced_vector<ft::vector<std::string> >  traced(vector, trace);
+
+        for (size_t i = 0; i < settings.count; ++i)
+        {
+            uint64_t    roll = random.next() % 100;
+
+            if (roll < 60 || !traced.size())
+                traced.push_back(std::string(value_sizes[random.next() % 4], 'v'));
+            else if (roll < 95)
+                bench::consume(traced[(size_t)(keys[i] >> 1) % traced.size()].size());
+            else
+                traced.pop_back();
+        }
+        return trace.records();
+    }
+
+    ft::map<long, std::string>                          map;
+    bench::traced_map<ft::map<long, std::string> >      traced(map, trace);
+
+    for (size_t i = 0; i < settings.count; ++i)
+    {
+        uint64_t    roll = random.next() % 100;
+
+        if (roll < 30)
+            traced.insert(ft::make_pair(keys[i], std::string(value_sizes[random.next() % 4], 'v')));
+        else if (roll < 70)
+            bench::consume(traced.find(keys[random.next() % (i + 1)]) != traced.end());
+        else if (roll < 85)
+            bench::consume(traced.lower_bound(keys[i] + 1) != traced.end());
+        else
+            traced.erase(keys[random.next() % (i + 1)]);
+    }
+    return trace.records();
+}
+
+template <class Backend>
+void    replay(const config &settings, const std::vector<bench::trace_record> &records, const char *container,
+               const char *implementation, bench::report &report)
+{
+    typename Backend::container_type    target;
+    bench::result                       entries[bench::trace_operations + 1];
+    size_t                              skipped = 0;
+    size_t                              value_bytes = 0;
+    double                              rate = bench::ticks_per_ns();
+    double                              start;
+
+    for (int i = 0; i <= bench::trace_operations; ++i)
+    {
+        entries[i].operations = 0;
+        entries[i].seconds = 0;
+    }
+    start = bench::now();
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const bench::trace_record   &record = records[i];
+        bool                        applied;
+
+        value_bytes += record.value_size;
+        if (!settings.latency)
+        {
+            applied = Backend::apply(target, record);
+            entries[record.operation].operations += applied;
+            skipped += !applied;
+            continue;
+        }
+
+        uint64_t    first = bench::ticks();
+
+        applied = Backend::apply(target, record);
+
+        uint64_t    ns = (uint64_t)((bench::ticks() - first) / rate);
+
+        if (!applied)
+        {
+            ++skipped;
+            continue;
+        }
+        entries[record.operation].operations++;
+        entries[record.operation].seconds += ns * 1e-9;
+        entries[record.operation].latency.record(ns);
+        entries[bench::trace_operations].latency.record(ns);
+    }
+
+    bench::result   &total = entries[bench::trace_operations];
+
+    total.seconds = bench::now() - start;
+    total.operations = records.size() - skipped;
+    std::cerr << container << " " << implementation << ": " << total.operations << " ops, " << skipped
+              << " skipped, " << (total.seconds > 0 ? total.operations / total.seconds / 1e6 : 0) << " Mops/s";
+    if (settings.latency && total.operations)
+        std::cerr << ", p50 " << total.latency.percentile(0.5) << " ns, p99 " << total.latency.percentile(0.99)
+                  << " ns, p99.9 " << total.latency.percentile(0.999) << " ns, max " << total.latency.max() << " ns";
+    std::cerr << std::endl;
+    for (int i = 0; i <= bench::trace_operations; ++i)
+    {
+        bench::result   &entry = entries[i];
+
+        if (!entry.operations)
+            continue;
+        entry.container = container;
+        entry.implementation = implementation;
+        entry.operation = i == bench::trace_operations ? "all" : bench::trace_name(i);
+        entry.distribution = "trace";
+        entry.size = records.size();
+        entry.value_size = records.empty() ? 0 : value_bytes / records.size();
+        if (!settings.latency && i != bench::trace_operations)
+            entry.seconds = 0;
+        report.add(entry);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    config                              settings;
+    bench::report                       report;
+    std::vector<bench::trace_record>    records;
+    bench::trace_record                 record;
+
+    settings.workload = "map";
+    settings.distribution = "zipf";
+    settings.count = 1000000;
+    settings.latency = true;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument(argv[i]);
+        size_t      equal = argument.find('=');
+        std::string name = argument.substr(0, equal);
+        std::string value = equal == std::string::npos ? "" : argument.substr(equal + 1);
+
+        if (name == "trace")
+            settings.trace = value;
+        else if (name == "record")
+            settings.record = value;
+        else if (name == "workload" && (value == "map" || value == "vector"))
+            settings.workload = value;
+        else if (name == "distribution")
+            settings.distribution = value;
+        else if (name == "count")
+            settings.count = (size_t)strtod(value.c_str(), 0);
+        else if (name == "backends")
+            settings.backends = split(value);
+        else if (name == "latency" && (value == "on" || value == "off"))
+            settings.latency = value == "on";
+        else if (name == "json")
+            settings.json = value;
+        else if (name == "csv")
+            settings.csv = value;
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " record=path [workload=map,vector]"
+                      << " [distribution=sequential,uniform,zipf] [count=N]" << std::endl
+                      << "       " << argv[0] << " trace=path [backends=ft_map,std_map,ft_set,std_set,"
+                      << "buffered_map,ft_sorted_vector,std_sorted_vector,ft_vector,std_vector]"
+                      << " [latency=on,off] [json=path] [csv=path]" << std::endl;
+            return 1;
+        }
+    }
+    if (!settings.record.empty())
+    {
+        size_t  written = record_trace(settings);
+
+        if (!written)
+        {
+            std::cerr << "cannot write trace " << settings.record << std::endl;
+            return 1;
+        }
+        std::cerr << "recorded " << written << " operations to " << settings.record << std::endl;
+        if (settings.trace.empty())
+            return 0;
+    }
+
+    bench::trace_reader trace(settings.trace.c_str());
+
+    if (!trace.good())
+    {
+        std::cerr << "cannot read trace " << settings.trace << std::endl;
+        return 1;
+    }
+    while (trace.next(record))
+        records.push_back(record);
+    if (selected(settings.backends, "ft_map"))
+        replay<map_backend<ft::map<long, std::string> > >(settings, records, "map", "ft", report);
+    if (selected(settings.backends, "std_map"))
+        replay<map_backend<std::map<long, std::string> > >(settings, records, "map", "std", report);
+    if (selected(settings.backends, "ft_set"))
+        replay<set_backend<ft::set<long> > >(settings, records, "set", "ft", report);
+    if (selected(settings.backends, "std_set"))
+        replay<set_backend<std::set<long> > >(settings, records, "set", "std", report);
+    if (selected(settings.backends, "buffered_map"))
+        replay<buffered_map_backend>(settings, records, "buffered_map", "ft", report);
+    if (selected(settings.backends, "ft_sorted_vector"))
+        replay<sorted_vector_backend<ft::vector<ft::pair<long, std::string> > > >(
+            settings, records, "sorted_vector", "ft", report);
+    if (selected(settings.backends, "std_sorted_vector"))
+        replay<sorted_vector_backend<std::vector<std::pair<long, std::string> > > >(
+            settings, records, "sorted_vector", "std", report);
+    if (selected(settings.backends, "ft_vector"))
+        replay<sequence_backend<ft::vector<std::string> > >(settings, records, "vector", "ft", report);
+    if (selected(settings.backends, "std_vector"))
+        replay<sequence_backend<std::vector<std::string> > >(settings, records, "vector", "std", report);
+    if (!settings.json.empty())
+    {
+        std::ofstream   out(settings.json.c_str());
+
+        report.write_json(out);
+    }
+    if (!settings.csv.empty())
+    {
+        std::ofstream   out(settings.csv.c_str());
+
+        report.write_csv(out);
+    }
+    if (settings.json.empty() && settings.csv.empty())
+        report.write_csv(std::cout);
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "stack/stack.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+typedef ft::stack<long, ft::vector<long> >  vector_stack;
+
+size_t  resident_mb()
+{
+    std::ifstream   statm("/proc/self/statm");
+    size_t          pages = 0;
+    size_t          resident = 0;
+
+    statm >> pages >> resident;
+    return resident * (size_t)sysconf(_SC_PAGESIZE) >> 20;
+}
+
+void    push(ft::vector<long> &vector, long value)
+{
+    vector.push_back(value);
+}
+
+void    push(vector_stack &stack, long value)
+{
+    stack.push(value);
+}
+
+void    push(ft::stack<long> &stack, long value)
+{
+    stack.push(value);
+}
+
+void    pop(ft::vector<long> &vector)
+{
+    vector.pop_back();
+}
+
+template <class Stack>
+void    pop(Stack &stack)
+{
+    stack.pop();
+}
+
+template <class Container>
+void    configure(Container &container, const ft::shrink_policy &policy)
+{
+    container.set_shrink_policy(policy);
+}
+
+template <class Container>
+void    run(const char *name, size_t count, const ft::shrink_policy &policy, bool shrink)
+{
+    Container       container;
+    struct rusage   usage;
+    size_t          baseline = resident_mb();
+
+    if (policy.enabled())
+        configure(container, policy);
+    for (size_t i = 0; i < count; ++i)
+        push(container, (long)i);
+
+    double  start = bench::now();
+
+    while (container.size() > count / 100)
+        pop(container);
+    if (shrink)
+        container.shrink_to_fit();
+
+    double  drain = bench::now() - start;
+
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << name << ": peak RSS " << usage.ru_maxrss / 1024 << " MB, RSS after drain "
+              << resident_mb() - baseline << " MB above baseline, drain " << drain * 1e3 << " ms" << std::endl;
+}
+
+template <class Container>
+void    isolated(const char *name, size_t count, const ft::shrink_policy &policy, bool shrink)
+{
+    pid_t   pid = fork();
+
+    if (pid == 0)
+    {
+        run<Container>(name, count, policy, shrink);
+        exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, 0, 0);
+}
+
+int main(int argc, char **argv)
+{
+    size_t              count = argc > 1 ? (size_t)strtod(argv[1], 0) : 50000000;
+    ft::shrink_policy   hysteresis = ft::shrink_policy::hysteresis();
+
+    std::cout << "burst of " << count << " longs, drained to 1%" << std::endl;
+    isolated<ft::vector<long> >("vector", count, ft::shrink_policy::never(), false);
+    isolated<ft::vector<long> >("vector + shrink_to_fit", count, ft::shrink_policy::never(), true);
+    isolated<ft::vector<long> >("vector + hysteresis", count, hysteresis, false);
+    isolated<vector_stack>("stack<vector> + hysteresis", count, hysteresis, false);
+    isolated<ft::stack<long> >("stack<deque>", count, ft::shrink_policy::never(), false);
+    isolated<ft::stack<long> >("stack<deque> + shrink_to_fit", count, ft::shrink_policy::never(), true);
+    isolated<ft::stack<long> >("stack<deque> + hysteresis", count, hysteresis, false);
+    return 0;
+}
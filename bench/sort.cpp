@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include "algorithm/sort.hpp"
+#include "vector/vector.hpp"
+#include "timer.hpp"
+
+enum pattern
+{
+    random_keys,
+    sorted_keys,
+    reversed_keys,
+    few_unique_keys
+};
+
+template <class T>
+void    fill(ft::vector<T> &data, size_t size, pattern kind)
+{
+    data.clear();
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (kind == random_keys)
+            data.push_back(T(rand() - RAND_MAX / 2));
+        else if (kind == sorted_keys)
+            data.push_back(T(i));
+        else if (kind == reversed_keys)
+            data.push_back(T(size - i));
+        else
+            data.push_back(T(rand() % 16));
+    }
+}
+
+template <class T>
+bool    sorted(const ft::vector<T> &data)
+{
+    for (size_t i = 1; i < data.size(); ++i)
+        if (data[i] < data[i - 1])
+            return false;
+    return true;
+}
+
+template <class T>
+void    run(const char *type, size_t size, pattern kind, ft::thread_pool &pool)
+{
+    const char      *names[4] = {"random", "sorted", "reversed", "few_unique"};
+    ft::vector<T>   input;
+    double          times[4];
+    bool            ok = true;
+
+    fill(input, size, kind);
+
+    std::vector<T>  reference(input.begin(), input.end());
+    double          start = bench::now();
+
+    std::sort(reference.begin(), reference.end());
+    times[0] = bench::now() - start;
+    for (int variant = 1; variant < 4; ++variant)
+    {
+        ft::vector<T>   data(input);
+
+        start = bench::now();
+        if (variant == 1)
+            ft::sort(data.begin(), data.end());
+        else if (variant == 2)
+            ft::stable_sort(data.begin(), data.end());
+        else
+            ft::sort(ft::execution::parallel_policy(pool), data.begin(), data.end());
+        times[variant] = bench::now() - start;
+        ok = ok && sorted(data);
+    }
+    std::cout << type << " " << names[kind] << ": std::sort " << times[0] * 1e3 << " ms"
+              << ", ft::sort " << times[1] * 1e3 << " ms (x" << times[0] / times[1] << ")"
+              << ", ft::stable_sort " << times[2] * 1e3 << " ms (x" << times[0] / times[2] << ")"
+              << ", ft::sort(par) " << times[3] * 1e3 << " ms (x" << times[0] / times[3] << ")"
+              << (ok ? "" : " [UNSORTED]") << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t          size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 22;
+    size_t          threads = argc > 2 ? strtoul(argv[2], 0, 10) : ft::thread_pool::hardware_threads();
+    ft::thread_pool pool(threads);
+
+    std::cout << "elements: " << size << ", threads: " << threads << std::endl;
+    for (int kind = random_keys; kind <= few_unique_keys; ++kind)
+    {
+        run<int>("int", size, pattern(kind), pool);
+        run<unsigned long long>("u64", size, pattern(kind), pool);
+        run<double>("double", size, pattern(kind), pool);
+    }
+    return 0;
+}
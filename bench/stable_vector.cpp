@@ -0,0 +1,53 @@
+#include <iostream>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "vector/stable_vector.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <class Vector>
+void    run(const char *name, size_t count)
+{
+    Vector              vector;
+    bench::histogram    latency;
+    double              rate = bench::ticks_per_ns();
+    struct rusage       usage;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t    start = bench::ticks();
+
+        vector.push_back((long)i);
+        latency.record((uint64_t)((bench::ticks() - start) / rate));
+    }
+    getrusage(RUSAGE_SELF, &usage);
+    std::cout << name << ": p50 " << latency.percentile(0.5) << " ns, p99 " << latency.percentile(0.99)
+              << " ns, p99.9 " << latency.percentile(0.999) << " ns, p99.99 " << latency.percentile(0.9999)
+              << " ns, max " << latency.max() << " ns, peak RSS " << usage.ru_maxrss / 1024 << " MB" << std::endl;
+}
+
+template <class Vector>
+void    isolated(const char *name, size_t count)
+{
+    pid_t   pid = fork();
+
+    if (pid == 0)
+    {
+        run<Vector>(name, count);
+        exit(0);
+    }
+    if (pid > 0)
+        waitpid(pid, 0, 0);
+}
+
+int main(int argc, char **argv)
+{
+    size_t  count = argc > 1 ? (size_t)strtod(argv[1], 0) : 100000000;
+
+    std::cout << "push_back of " << count << " longs (" << count * sizeof(long) / 1e6 << " MB)" << std::endl;
+    isolated<ft::vector<long> >("vector", count);
+    isolated<ft::stable_vector<long> >("stable_vector", count);
+    return 0;
+}
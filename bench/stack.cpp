@@ -0,0 +1,54 @@
+#include <iostream>
+#include <memory>
+#include <stdlib.h>
+#include "stack/stack.hpp"
+#include "deque/deque.hpp"
+#include "vector/vector.hpp"
+#include "utilities/stats_allocator.hpp"
+#include "timer.hpp"
+
+struct Buffer
+{
+    int     idx;
+    char    buff[4096];
+};
+
+template <class Stack>
+void    run(const char *name, size_t count, const typename Stack::value_type &value)
+{
+    ft::allocation_stats    &stats = ft::allocation_stats::global();
+
+    stats.reset();
+
+    double  push;
+    double  pop;
+    {
+        Stack   stack;
+        double  start = bench::now();
+
+        for (size_t i = 0; i < count; ++i)
+            stack.push(value);
+        push = bench::now() - start;
+        start = bench::now();
+        for (size_t i = 0; i < count; ++i)
+            stack.pop();
+        pop = bench::now() - start;
+    }
+    std::cout << name << " push: " << count / push / 1e6 << " Mops/s"
+              << " pop: " << count / pop / 1e6 << " Mops/s"
+              << " peak: " << stats.peak_bytes / (1024.0 * 1024.0) << " MiB"
+              << " allocations: " << stats.allocations << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  count = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 16;
+    Buffer  buffer = Buffer();
+
+    std::cout << "elements: " << count << std::endl;
+    run<ft::stack<int, ft::vector<int, ft::stats_allocator<int> > > >("int vector", count * 64, 1);
+    run<ft::stack<int, ft::deque<int, ft::stats_allocator<int> > > >("int deque ", count * 64, 1);
+    run<ft::stack<Buffer, ft::vector<Buffer, ft::stats_allocator<Buffer> > > >("4K vector ", count, buffer);
+    run<ft::stack<Buffer, ft::deque<Buffer, ft::stats_allocator<Buffer> > > >("4K deque  ", count, buffer);
+    return 0;
+}
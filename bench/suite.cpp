@@ -0,0 +1,562 @@
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stack>
+#include <vector>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "set/set.hpp"
+#include "stack/stack.hpp"
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <size_t Size>
+struct payload
+{
+    char    data[Size];
+
+    payload()
+    {
+        data[0] = 1;
+    }
+};
+
+template <class T>
+size_t  allocated_bytes(const T &)
+{
+    return 0;
+}
+
+template <class T, class Allocator>
+size_t  allocated_bytes(const std::vector<T, Allocator> &vector)
+{
+    return vector.capacity() * sizeof(T);
+}
+
+template <class T, class Allocator>
+size_t  allocated_bytes(const ft::vector<T, Allocator> &vector)
+{
+    return vector.memory_usage().allocated_bytes;
+}
+
+template <class T, class Container>
+size_t  allocated_bytes(const ft::stack<T, Container> &stack)
+{
+    return stack.memory_usage().allocated_bytes;
+}
+
+template <class T>
+void    read_counters(const T &, bench::probe &) {}
+
+#ifdef FT_TREE_COUNTERS
+template <class Tree>
+void    read_tree_counters(const Tree &tree, bench::probe &probe)
+{
+    ft::tree_counters   counters = tree.counters();
+
+    probe.rotations = counters.rotations;
+    probe.recolorings = counters.recolorings;
+}
+
+template <class Key, class T, class Compare, class Allocator>
+void    read_counters(const ft::map<Key, T, Compare, Allocator> &map, bench::probe &probe)
+{
+    read_tree_counters(map, probe);
+}
+
+template <class Key, class Compare, class Allocator>
+void    read_counters(const ft::set<Key, Compare, Allocator> &set, bench::probe &probe)
+{
+    read_tree_counters(set, probe);
+}
+#endif
+
+template <class Container>
+bench::probe    inspect(const Container &container)
+{
+    bench::probe    probe = {(size_t)container.size(), allocated_bytes(container), 0, 0, 0, 0};
+
+    read_counters(container, probe);
+    bench::read_process(probe);
+    return probe;
+}
+
+template <class Vector>
+struct vector_workload
+{
+    typedef typename Vector::value_type value_type;
+
+    static void empty(Vector &, const long *, size_t) {}
+
+    static void fill(Vector &vector, const long *, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            vector.push_back(value_type());
+    }
+
+    static void push_back(Vector &vector, const long *, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            vector.push_back(value_type());
+    }
+
+    static void iterate(Vector &vector, const long *, size_t, size_t)
+    {
+        long    sum = 0;
+
+        for (typename Vector::iterator it = vector.begin(); it != vector.end(); ++it)
+            sum += (*it).data[0];
+        bench::consume(sum);
+    }
+
+    static void random_read(Vector &vector, const long *keys, size_t first, size_t last)
+    {
+        long    sum = 0;
+        size_t  size = vector.size();
+
+        for (size_t i = first; i < last; ++i)
+            sum += vector[(size_t)(keys[i] >> 1) % size].data[0];
+        bench::consume(sum);
+    }
+
+    static std::vector<bench::operation<Vector> >   operations()
+    {
+        bench::operation<Vector>                table[] = {
+            {"push_back", empty, push_back, true, false},
+            {"iterate", fill, iterate, false, false},
+            {"random_read", fill, random_read, true, true}
+        };
+
+        return std::vector<bench::operation<Vector> >(table, table + sizeof(table) / sizeof(*table));
+    }
+};
+
+template <class Map>
+struct map_workload
+{
+    typedef typename Map::value_type    value_type;
+    typedef typename Map::mapped_type   mapped_type;
+
+    static void empty(Map &, const long *, size_t) {}
+
+    static void fill(Map &map, const long *keys, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            map.insert(value_type(keys[i], mapped_type()));
+    }
+
+    static void insert(Map &map, const long *keys, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            map.insert(value_type(keys[i], mapped_type()));
+    }
+
+    static void find_hit(Map &map, const long *keys, size_t first, size_t last)
+    {
+        long    found = 0;
+
+        for (size_t i = first; i < last; ++i)
+            found += map.find(keys[i]) != map.end();
+        bench::consume(found);
+    }
+
+    static void find_miss(Map &map, const long *keys, size_t first, size_t last)
+    {
+        long    found = 0;
+
+        for (size_t i = first; i < last; ++i)
+            found += map.find(keys[i] + 1) != map.end();
+        bench::consume(found);
+    }
+
+    static void erase(Map &map, const long *keys, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            map.erase(keys[i]);
+    }
+
+    static void clear(Map &map, const long *, size_t, size_t)
+    {
+        map.clear();
+    }
+
+    static void iterate(Map &map, const long *, size_t, size_t)
+    {
+        long    sum = 0;
+
+        for (typename Map::iterator it = map.begin(); it != map.end(); ++it)
+            sum += (*it).first;
+        bench::consume(sum);
+    }
+
+    static std::vector<bench::operation<Map> >  operations()
+    {
+        bench::operation<Map>                   table[] = {
+            {"insert", empty, insert, true, true},
+            {"find_hit", fill, find_hit, true, true},
+            {"find_miss", fill, find_miss, true, true},
+            {"erase", fill, erase, true, true},
+            {"iterate", fill, iterate, false, true},
+            {"clear", fill, clear, false, true}
+        };
+
+        return std::vector<bench::operation<Map> >(table, table + sizeof(table) / sizeof(*table));
+    }
+};
+
+template <class Set>
+struct set_workload
+{
+    static void empty(Set &, const long *, size_t) {}
+
+    static void fill(Set &set, const long *keys, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            set.insert(keys[i]);
+    }
+
+    static void insert(Set &set, const long *keys, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            set.insert(keys[i]);
+    }
+
+    static void find_hit(Set &set, const long *keys, size_t first, size_t last)
+    {
+        long    found = 0;
+
+        for (size_t i = first; i < last; ++i)
+            found += set.find(keys[i]) != set.end();
+        bench::consume(found);
+    }
+
+    static void find_miss(Set &set, const long *keys, size_t first, size_t last)
+    {
+        long    found = 0;
+
+        for (size_t i = first; i < last; ++i)
+            found += set.find(keys[i] + 1) != set.end();
+        bench::consume(found);
+    }
+
+    static void erase(Set &set, const long *keys, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            set.erase(keys[i]);
+    }
+
+    static void clear(Set &set, const long *, size_t, size_t)
+    {
+        set.clear();
+    }
+
+    static void iterate(Set &set, const long *, size_t, size_t)
+    {
+        long    sum = 0;
+
+        for (typename Set::iterator it = set.begin(); it != set.end(); ++it)
+            sum += *it;
+        bench::consume(sum);
+    }
+
+    static std::vector<bench::operation<Set> >  operations()
+    {
+        bench::operation<Set>                   table[] = {
+            {"insert", empty, insert, true, true},
+            {"find_hit", fill, find_hit, true, true},
+            {"find_miss", fill, find_miss, true, true},
+            {"erase", fill, erase, true, true},
+            {"iterate", fill, iterate, false, true},
+            {"clear", fill, clear, false, true}
+        };
+
+        return std::vector<bench::operation<Set> >(table, table + sizeof(table) / sizeof(*table));
+    }
+};
+
+template <class Stack>
+struct stack_workload
+{
+    typedef typename Stack::value_type  value_type;
+
+    static void empty(Stack &, const long *, size_t) {}
+
+    static void fill(Stack &stack, const long *, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            stack.push(value_type());
+    }
+
+    static void push(Stack &stack, const long *, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+            stack.push(value_type());
+    }
+
+    static void pop(Stack &stack, const long *, size_t first, size_t last)
+    {
+        long    sum = 0;
+
+        for (size_t i = first; i < last; ++i)
+        {
+            sum += stack.top().data[0];
+            stack.pop();
+        }
+        bench::consume(sum);
+    }
+
+    static void push_pop(Stack &stack, const long *keys, size_t first, size_t last)
+    {
+        for (size_t i = first; i < last; ++i)
+        {
+            if (keys[i] & 2)
+                stack.pop();
+            else
+                stack.push(value_type());
+        }
+    }
+
+    static std::vector<bench::operation<Stack> >    operations()
+    {
+        bench::operation<Stack>                     table[] = {
+            {"push", empty, push, true, false},
+            {"pop", fill, pop, true, false},
+            {"push_pop", fill, push_pop, true, true}
+        };
+
+        return std::vector<bench::operation<Stack> >(table, table + sizeof(table) / sizeof(*table));
+    }
+};
+
+struct config
+{
+    std::vector<std::string>    containers;
+    std::vector<std::string>    operations;
+    std::vector<std::string>    implementations;
+    std::vector<std::string>    distributions;
+    std::vector<size_t>         sizes;
+    std::vector<size_t>         value_sizes;
+    size_t                      repetitions;
+    bool                        latency;
+    bench::perf_counters        *counters;
+    size_t                      outliers;
+    std::string                 json;
+    std::string                 csv;
+};
+
+std::vector<std::string>    split(const std::string &list)
+{
+    std::vector<std::string>    items;
+    std::stringstream           stream(list);
+    std::string                 item;
+
+    while (std::getline(stream, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+std::vector<size_t>     split_sizes(const std::string &list)
+{
+    std::vector<std::string>    items = split(list);
+    std::vector<size_t>         sizes;
+
+    for (size_t i = 0; i < items.size(); ++i)
+        sizes.push_back((size_t)strtod(items[i].c_str(), 0));
+    return sizes;
+}
+
+bool    selected(const std::vector<std::string> &filter, const std::string &name)
+{
+    return filter.empty() || std::find(filter.begin(), filter.end(), name) != filter.end();
+}
+
+template <class Workload, class Container>
+void    run_workload(const config &settings, bench::report &report, const char *container,
+                     const char *implementation, size_t size, size_t value_size)
+{
+    std::vector<bench::operation<Container> >   table = Workload::operations();
+
+    for (size_t d = 0; d < settings.distributions.size(); ++d)
+    {
+        const std::string   &distribution = settings.distributions[d];
+        std::vector<long>   keys = bench::make_keys(distribution, size);
+
+        for (size_t i = 0; i < table.size(); ++i)
+        {
+            if (!selected(settings.operations, table[i].name) || (!table[i].keyed && d))
+                continue;
+
+            bench::result   entry;
+
+            entry.container = container;
+            entry.implementation = implementation;
+            entry.distribution = table[i].keyed ? distribution : "none";
+            entry.size = size;
+            entry.value_size = value_size;
+            std::cerr << container << " " << implementation << " " << table[i].name << " "
+                      << entry.distribution << " size=" << size << " value=" << value_size << std::endl;
+            if (!settings.latency)
+                bench::measure(table[i], keys, settings.repetitions, entry, settings.counters);
+            else
+            {
+                bench::measure_latency(table[i], inspect<Container>, keys, settings.repetitions,
+                                       settings.outliers, entry);
+                std::cerr << "  p50 " << entry.latency.percentile(0.5) << " ns, p99 "
+                          << entry.latency.percentile(0.99) << " ns, p99.9 " << entry.latency.percentile(0.999)
+                          << " ns, max " << entry.latency.max() << " ns" << std::endl;
+                for (size_t j = 0; j < entry.outliers.size(); ++j)
+                    std::cerr << "  outlier #" << entry.outliers[j].index << " " << entry.outliers[j].ns << " ns"
+                              << (entry.outliers[j].cause.empty() ? "" : ": ") << entry.outliers[j].cause
+                              << std::endl;
+            }
+            report.add(entry);
+        }
+    }
+}
+
+template <size_t ValueSize>
+void    run_value_size(const config &settings, bench::report &report, size_t size)
+{
+    typedef payload<ValueSize>  value_type;
+
+    for (size_t i = 0; i < settings.implementations.size(); ++i)
+    {
+        bool    ft = settings.implementations[i] == "ft";
+
+        if (selected(settings.containers, "vector"))
+        {
+            if (ft)
+                run_workload<vector_workload<ft::vector<value_type> >, ft::vector<value_type> >(
+                    settings, report, "vector", "ft", size, ValueSize);
+            else
+                run_workload<vector_workload<std::vector<value_type> >, std::vector<value_type> >(
+                    settings, report, "vector", "std", size, ValueSize);
+        }
+        if (selected(settings.containers, "map"))
+        {
+            if (ft)
+                run_workload<map_workload<ft::map<long, value_type> >, ft::map<long, value_type> >(
+                    settings, report, "map", "ft", size, ValueSize);
+            else
+                run_workload<map_workload<std::map<long, value_type> >, std::map<long, value_type> >(
+                    settings, report, "map", "std", size, ValueSize);
+        }
+        if (selected(settings.containers, "stack"))
+        {
+            if (ft)
+                run_workload<stack_workload<ft::stack<value_type> >, ft::stack<value_type> >(
+                    settings, report, "stack", "ft", size, ValueSize);
+            else
+                run_workload<stack_workload<std::stack<value_type> >, std::stack<value_type> >(
+                    settings, report, "stack", "std", size, ValueSize);
+        }
+    }
+}
+
+void    run_set(const config &settings, bench::report &report, size_t size)
+{
+    if (!selected(settings.containers, "set"))
+        return;
+    for (size_t i = 0; i < settings.implementations.size(); ++i)
+    {
+        if (settings.implementations[i] == "ft")
+            run_workload<set_workload<ft::set<long> >, ft::set<long> >(settings, report, "set", "ft", size, sizeof(long));
+        else
+            run_workload<set_workload<std::set<long> >, std::set<long> >(settings, report, "set", "std", size, sizeof(long));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    config                  settings;
+    bench::report           report;
+    bench::perf_counters    counters;
+
+    settings.implementations = split("ft,std");
+    settings.distributions = split("sequential,uniform,zipf");
+    settings.sizes = split_sizes("1e2,1e4,1e6");
+    settings.value_sizes = split_sizes("8,64,256");
+    settings.repetitions = 3;
+    settings.latency = false;
+    settings.counters = &counters;
+    settings.outliers = 8;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument(argv[i]);
+        size_t      equal = argument.find('=');
+        std::string name = argument.substr(0, equal);
+        std::string value = equal == std::string::npos ? "" : argument.substr(equal + 1);
+
+        if (name == "containers")
+            settings.containers = split(value);
+        else if (name == "operations")
+            settings.operations = split(value);
+        else if (name == "implementations")
+            settings.implementations = split(value);
+        else if (name == "distributions")
+            settings.distributions = split(value);
+        else if (name == "sizes")
+            settings.sizes = split_sizes(value);
+        else if (name == "values")
+            settings.value_sizes = split_sizes(value);
+        else if (name == "repetitions")
+            settings.repetitions = strtoul(value.c_str(), 0, 10);
+        else if (name == "mode" && (value == "throughput" || value == "latency"))
+            settings.latency = value == "latency";
+        else if (name == "counters" && (value == "on" || value == "off"))
+            settings.counters = value == "on" ? &counters : 0;
+        else if (name == "outliers")
+            settings.outliers = strtoul(value.c_str(), 0, 10);
+        else if (name == "json")
+            settings.json = value;
+        else if (name == "csv")
+            settings.csv = value;
+        else
+        {
+            std::cerr << "usage: " << argv[0] << " [containers=vector,map,set,stack] [operations=...]"
+                      << " [implementations=ft,std] [distributions=sequential,uniform,zipf]"
+                      << " [sizes=1e2,...,1e8] [values=8,64,256] [repetitions=N] [mode=throughput,latency]"
+                      << " [outliers=N] [counters=on,off] [json=path] [csv=path]"
+                      << std::endl;
+            return 1;
+        }
+    }
+    if (settings.counters && !counters.error().empty())
+        std::cerr << (counters.available() ? "some" : "all") << " performance counters unavailable ("
+                  << counters.error() << ")" << std::endl;
+    for (size_t s = 0; s < settings.sizes.size(); ++s)
+    {
+        size_t  size = settings.sizes[s];
+
+        for (size_t v = 0; v < settings.value_sizes.size(); ++v)
+        {
+            if (settings.value_sizes[v] == 8)
+                run_value_size<8>(settings, report, size);
+            else if (settings.value_sizes[v] == 64)
+                run_value_size<64>(settings, report, size);
+            else if (settings.value_sizes[v] == 256)
+                run_value_size<256>(settings, report, size);
+            else
+                std::cerr << "unsupported value size " << settings.value_sizes[v] << std::endl;
+        }
+        run_set(settings, report, size);
+    }
+    if (!settings.json.empty())
+    {
+        std::ofstream   out(settings.json.c_str());
+
+        report.write_json(out);
+    }
+    if (!settings.csv.empty())
+    {
+        std::ofstream   out(settings.csv.c_str());
+
+        report.write_csv(out);
+    }
+    if (settings.json.empty() && settings.csv.empty())
+        report.write_csv(std::cout);
+    return 0;
+}
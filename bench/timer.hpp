@@ -0,0 +1,58 @@
+#ifndef BENCH_TIMER_HPP
+#define BENCH_TIMER_HPP
+
+#include <time.h>
+#include <stdint.h>
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+namespace bench
+{
+    inline double  now()
+    {
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec * 1e-9;
+    }
+
+    inline uint64_t ticks()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_lfence();
+        uint64_t    value = __rdtsc();
+        _mm_lfence();
+
+        return value;
+#else
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+    }
+
+    inline double   ticks_per_ns()
+    {
+        static double   rate = 0;
+
+        if (rate == 0)
+        {
+            double      start = now();
+            uint64_t    first = ticks();
+
+            while (now() - start < 0.02)
+                ;
+
+            double      elapsed = now() - start;
+
+            rate = (ticks() - first) / (elapsed * 1e9);
+            if (rate <= 0)
+                rate = 1;
+        }
+        return rate;
+    }
+}
+
+#endif
@@ -0,0 +1,392 @@
+#ifndef BENCH_TRACE_HPP
+#define BENCH_TRACE_HPP
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdint.h>
+
+namespace bench
+{
+    enum trace_operation
+    {
+        trace_insert,
+        trace_find,
+        trace_erase,
+        trace_lower_bound,
+        trace_clear,
+        trace_push_back,
+        trace_pop_back,
+        trace_read,
+        trace_operations
+    };
+
+    inline const char   *trace_name(int operation)
+    {
+        static const char   *names[trace_operations] = {
+            "insert", "find", "erase", "lower_bound", "clear", "push_back", "pop_back", "read"
+        };
+
+        return operation >= 0 && operation < trace_operations ? names[operation] : "unknown";
+    }
+
+    struct trace_record
+    {
+        int     operation;
+        long    key;
+        size_t  value_size;
+    };
+
+    class trace_writer
+    {
+    public:
+        explicit trace_writer(const char *path) : _file(std::fopen(path, "wb")), _key(0), _value_size(0), _records(0)
+        {
+            if (_file)
+                std::fwrite(magic(), 1, 8, _file);
+        }
+
+        ~trace_writer()
+        {
+            close();
+        }
+
+        bool    good() const
+        {
+            return _file != 0;
+        }
+
+        size_t  records() const
+        {
+            return _records;
+        }
+
+        void    write(int operation, long key = 0, size_t value_size = 0)
+        {
+            unsigned char   header = (unsigned char)operation;
+
+            if (!_file)
+                return;
+            if (has_key(operation))
+                header |= key_flag;
+            if (value_size != _value_size)
+                header |= value_flag;
+            std::fputc(header, _file);
+            if (header & key_flag)
+            {
+                uint64_t    delta = (uint64_t)key - (uint64_t)_key;
+
+                write_varint((delta << 1) ^ (uint64_t)((int64_t)delta >> 63));
+                _key = key;
+            }
+            if (header & value_flag)
+            {
+                write_varint(value_size);
+                _value_size = value_size;
+            }
+            ++_records;
+        }
+
+        void    close()
+        {
+            if (_file)
+                std::fclose(_file);
+            _file = 0;
+        }
+
+    private:
+        enum { key_flag = 0x10, value_flag = 0x20 };
+
+        std::FILE   *_file;
+        long        _key;
+        size_t      _value_size;
+        size_t      _records;
+
+        trace_writer(const trace_writer &);
+        trace_writer    &operator=(const trace_writer &);
+
+        static const char   *magic()
+        {
+            return "FTTRACE1";
+        }
+
+        static bool has_key(int operation)
+        {
+            return operation != trace_clear && operation != trace_pop_back;
+        }
+
+        void    write_varint(uint64_t value)
+        {
+            while (value >= 0x80)
+            {
+                std::fputc((int)(value & 0x7f) | 0x80, _file);
+                value >>= 7;
+            }
+            std::fputc((int)value, _file);
+        }
+
+        friend class trace_reader;
+    };
+
+    class trace_reader
+    {
+    public:
+        explicit trace_reader(const char *path) : _file(std::fopen(path, "rb")), _key(0), _value_size(0)
+        {
+            char    header[8];
+
+            if (_file && (std::fread(header, 1, 8, _file) != 8 || std::memcmp(header, trace_writer::magic(), 8)))
+            {
+                std::fclose(_file);
+                _file = 0;
+            }
+        }
+
+        ~trace_reader()
+        {
+            if (_file)
+                std::fclose(_file);
+        }
+
+        bool    good() const
+        {
+            return _file != 0;
+        }
+
+        bool    next(trace_record &record)
+        {
+            int         header = _file ? std::fgetc(_file) : EOF;
+            uint64_t    value;
+
+            if (header == EOF || (header & 0x0f) >= trace_operations)
+                return false;
+            record.operation = header & 0x0f;
+            if (header & trace_writer::key_flag)
+            {
+                if (!read_varint(value))
+                    return false;
+                _key = (long)((uint64_t)_key + ((value >> 1) ^ (0 - (value & 1))));
+            }
+            if (header & trace_writer::value_flag)
+            {
+                if (!read_varint(value))
+                    return false;
+                _value_size = (size_t)value;
+            }
+            record.key = (header & trace_writer::key_flag) ? _key : 0;
+            record.value_size = _value_size;
+            return true;
+        }
+
+    private:
+        std::FILE   *_file;
+        long        _key;
+        size_t      _value_size;
+
+        trace_reader(const trace_reader &);
+        trace_reader    &operator=(const trace_reader &);
+
+        bool    read_varint(uint64_t &value)
+        {
+            int     byte;
+            int     shift = 0;
+
+            value = 0;
+            while ((byte = std::fgetc(_file)) != EOF && shift < 64)
+            {
+                value |= (uint64_t)(byte & 0x7f) << shift;
+                if (!(byte & 0x80))
+                    return true;
+                shift += 7;
+            }
+            return false;
+        }
+    };
+
+    template <class T>
+    size_t  trace_value_size(const T &)
+    {
+        return sizeof(T);
+    }
+
+    inline size_t   trace_value_size(const std::string &value)
+    {
+        return value.size();
+    }
+
+    template <class Map>
+    class traced_map
+    {
+    public:
+        typedef typename Map::key_type          key_type;
+        typedef typename Map::mapped_type       mapped_type;
+        typedef typename Map::value_type        value_type;
+        typedef typename Map::iterator          iterator;
+        typedef typename Map::size_type         size_type;
+
+        traced_map(Map &map, trace_writer &trace) : _map(map), _trace(trace) {}
+
+        iterator    insert(const value_type &value)
+        {
+            _trace.write(trace_insert, (long)value.first, trace_value_size(value.second));
+            return _map.insert(value).first;
+        }
+
+        mapped_type &operator[](const key_type &key)
+        {
+            _trace.write(trace_insert, (long)key, sizeof(mapped_type));
+            return _map[key];
+        }
+
+        iterator    find(const key_type &key)
+        {
+            _trace.write(trace_find, (long)key);
+            return _map.find(key);
+        }
+
+        size_type   count(const key_type &key)
+        {
+            _trace.write(trace_find, (long)key);
+            return _map.count(key);
+        }
+
+        iterator    lower_bound(const key_type &key)
+        {
+            _trace.write(trace_lower_bound, (long)key);
+            return _map.lower_bound(key);
+        }
+
+        size_type   erase(const key_type &key)
+        {
+            _trace.write(trace_erase, (long)key);
+            return _map.erase(key);
+        }
+
+        void        clear()
+        {
+            _trace.write(trace_clear);
+            _map.clear();
+        }
+
+        iterator    end()
+        {
+            return _map.end();
+        }
+
+        size_type   size() const
+        {
+            return _map.size();
+        }
+
+    private:
+        Map             &_map;
+        trace_writer    &_trace;
+    };
+
+    template <class Set>
+    class traced_set
+    {
+    public:
+        typedef typename Set::key_type      key_type;
+        typedef typename Set::iterator      iterator;
+        typedef typename Set::size_type     size_type;
+
+        traced_set(Set &set, trace_writer &trace) : _set(set), _trace(trace) {}
+
+        iterator    insert(const key_type &key)
+        {
+            _trace.write(trace_insert, (long)key, sizeof(key_type));
+            return _set.insert(key).first;
+        }
+
+        iterator    find(const key_type &key)
+        {
+            _trace.write(trace_find, (long)key);
+            return _set.find(key);
+        }
+
+        size_type   count(const key_type &key)
+        {
+            _trace.write(trace_find, (long)key);
+            return _set.count(key);
+        }
+
+        iterator    lower_bound(const key_type &key)
+        {
+            _trace.write(trace_lower_bound, (long)key);
+            return _set.lower_bound(key);
+        }
+
+        size_type   erase(const key_type &key)
+        {
+            _trace.write(trace_erase, (long)key);
+            return _set.erase(key);
+        }
+
+        void        clear()
+        {
+            _trace.write(trace_clear);
+            _set.clear();
+        }
+
+        iterator    end()
+        {
+            return _set.end();
+        }
+
+        size_type   size() const
+        {
+            return _set.size();
+        }
+
+    private:
+        Set             &_set;
+        trace_writer    &_trace;
+    };
+
+    template <class Vector>
+    class traced_vector
+    {
+    public:
+        typedef typename Vector::value_type     value_type;
+        typedef typename Vector::reference      reference;
+        typedef typename Vector::size_type      size_type;
+
+        traced_vector(Vector &vector, trace_writer &trace) : _vector(vector), _trace(trace) {}
+
+        void        push_back(const value_type &value)
+        {
+            _trace.write(trace_push_back, (long)_vector.size(), trace_value_size(value));
+            _vector.push_back(value);
+        }
+
+        void        pop_back()
+        {
+            _trace.write(trace_pop_back);
+            _vector.pop_back();
+        }
+
+        reference   operator[](size_type index)
+        {
+            _trace.write(trace_read, (long)index);
+            return _vector[index];
+        }
+
+        void        clear()
+        {
+            _trace.write(trace_clear);
+            _vector.clear();
+        }
+
+        size_type   size() const
+        {
+            return _vector.size();
+        }
+
+    private:
+        Vector          &_vector;
+        trace_writer    &_trace;
+    };
+}
+
+#endif
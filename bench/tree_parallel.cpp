@@ -0,0 +1,95 @@
+#include <iostream>
+#include <stdlib.h>
+#include "map/map.hpp"
+#include "timer.hpp"
+
+struct add
+{
+    long    operator()(long lhs, long rhs) const
+    {
+        return lhs + rhs;
+    }
+};
+
+struct mapped
+{
+    long    operator()(const ft::pair<const int, int> &value) const
+    {
+        return value.second;
+    }
+};
+
+struct touch
+{
+    void    operator()(ft::pair<const int, int> &value) const
+    {
+        value.second = value.second * 3 + 1;
+    }
+};
+
+template <class Policy>
+void    run(const Policy &policy, size_t threads, ft::map<int, int> &source, double *baseline)
+{
+    double  times[4];
+    double  start = bench::now();
+
+    {
+        ft::map<int, int>   copy(source, policy);
+
+        times[0] = bench::now() - start;
+        start = bench::now();
+        copy.for_each(policy, touch());
+        times[1] = bench::now() - start;
+        start = bench::now();
+        long    sum = copy.reduce(policy, 0L, add(), mapped());
+        times[2] = bench::now() - start;
+        start = bench::now();
+        copy.clear(policy);
+        times[3] = bench::now() - start;
+
+        const char  *names[4] = {"copy", "for_each", "reduce", "clear"};
+
+        std::cout << "threads=" << threads;
+        for (size_t i = 0; i < 4; ++i)
+        {
+            if (!baseline[i])
+                baseline[i] = times[i];
+            std::cout << " " << names[i] << ": " << times[i] * 1e3 << " ms (x" << baseline[i] / times[i] << ")";
+        }
+        std::cout << " [" << sum << "]" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    size_t              size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 22;
+    size_t              max_threads = argc > 2 ? strtoul(argv[2], 0, 10) : ft::thread_pool::hardware_threads();
+    ft::map<int, int>   source;
+    double              baseline[4] = {0, 0, 0, 0};
+    double              start = bench::now();
+
+    for (size_t i = 0; i < size; ++i)
+        source[rand()] = i;
+    std::cout << "entries: " << source.size() << ", build " << (bench::now() - start) * 1e3 << " ms" << std::endl;
+    start = bench::now();
+    {
+        ft::map<int, int>   copy;
+
+        for (ft::map<int, int>::iterator it = source.begin(); it != source.end(); ++it)
+            copy.insert(*it);
+        std::cout << "element-wise copy: " << (bench::now() - start) * 1e3 << " ms" << std::endl;
+    }
+    for (size_t threads = 1; threads <= max_threads; threads *= 2)
+    {
+        ft::thread_pool pool(threads);
+
+        run(ft::execution::parallel_policy(pool), threads, source, baseline);
+        if (threads * 2 > max_threads && threads != max_threads)
+        {
+            ft::thread_pool last(max_threads);
+
+            run(ft::execution::parallel_policy(last), max_threads, source, baseline);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+#define FT_TREE_COUNTERS
+
+#include <iostream>
+#include <stdlib.h>
+#include "set/set.hpp"
+#include "harness.hpp"
+
+void    print_counters(const char *phase, const ft::set<long> &set, size_t operations)
+{
+    ft::tree_counters   counters = set.counters();
+    double              scale = operations ? 1.0 / operations : 0;
+
+    std::cout << phase << " (" << operations << " ops): comparisons/op " << counters.comparisons * scale
+              << ", rotations/op " << counters.rotations * scale
+              << ", recolorings/op " << counters.recolorings * scale
+              << ", visited/op " << counters.visited * scale << std::endl;
+}
+
+void    print_shape(const ft::set<long> &set)
+{
+    ft::tree_diagnostics    shape = set.diagnostics();
+
+    std::cout << "  nodes " << shape.nodes << ", height " << shape.height << ", black height "
+              << shape.black_height << ", average depth " << shape.average_depth
+              << ", violations " << shape.violations() << std::endl;
+}
+
+void    run(const std::string &distribution, size_t size)
+{
+    std::vector<long>   keys = bench::make_keys(distribution, size);
+    ft::set<long>       set;
+
+    std::cout << distribution << ":" << std::endl;
+    for (size_t i = 0; i < size; ++i)
+        set.insert(keys[i]);
+    print_counters("  insert", set, size);
+    print_shape(set);
+    set.reset_counters();
+    for (size_t i = 0; i < size; ++i)
+        bench::consume(set.count(keys[i]));
+    print_counters("  find", set, size);
+    set.reset_counters();
+    for (size_t i = 0; i < size; i += 2)
+        set.erase(keys[i]);
+    print_counters("  erase", set, (size + 1) / 2);
+    print_shape(set);
+}
+
+int main(int argc, char **argv)
+{
+    size_t  size = argc > 1 ? strtoul(argv[1], 0, 10) : 1 << 20;
+
+    run("sequential", size);
+    run("uniform", size);
+    run("zipf", size);
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+#include "vector/vector.hpp"
+#include "harness.hpp"
+
+template <class Vector>
+void    fill(Vector &vector, size_t count, unsigned seed)
+{
+    srand(seed);
+    vector.resize(count);
+    for (size_t i = 0; i < count; ++i)
+        vector[i] = (rand() & 7) == 0;
+}
+
+size_t  count(const ft::vector<bool> &vector)
+{
+    return vector.count();
+}
+
+size_t  count(const std::vector<bool> &vector)
+{
+    return std::count(vector.begin(), vector.end(), true);
+}
+
+size_t  find_all(const ft::vector<bool> &vector)
+{
+    size_t  found = 0;
+
+    for (size_t i = vector.find_first_set(); i < vector.size(); i = vector.find_next_set(i + 1))
+        ++found;
+    return found;
+}
+
+size_t  find_all(const std::vector<bool> &vector)
+{
+    size_t  found = 0;
+
+    for (std::vector<bool>::const_iterator it = std::find(vector.begin(), vector.end(), true);
+         it != vector.end(); it = std::find(it + 1, vector.end(), true))
+        ++found;
+    return found;
+}
+
+void    combine(ft::vector<bool> &lhs, const ft::vector<bool> &rhs, int operation)
+{
+    if (operation == 0)
+        lhs &= rhs;
+    else if (operation == 1)
+        lhs |= rhs;
+    else
+        lhs ^= rhs;
+}
+
+void    combine(std::vector<bool> &lhs, const std::vector<bool> &rhs, int operation)
+{
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (operation == 0)
+            lhs[i] = lhs[i] && rhs[i];
+        else if (operation == 1)
+            lhs[i] = lhs[i] || rhs[i];
+        else
+            lhs[i] = lhs[i] != rhs[i];
+    }
+}
+
+size_t  memory(const ft::vector<bool> &vector)
+{
+    return vector.memory_usage().allocated_bytes;
+}
+
+size_t  memory(const std::vector<bool> &vector)
+{
+    return sizeof(vector) + (vector.capacity() + 7) / 8;
+}
+
+template <class Vector>
+void    run(const char *name, size_t count_bits, int reps)
+{
+    Vector          lhs;
+    Vector          rhs;
+    size_t          checksum = 0;
+    const char      *operations[] = {"and", "or", "xor"};
+
+    fill(lhs, count_bits, 1);
+    fill(rhs, count_bits, 2);
+    std::cout << name << ": " << memory(lhs) / 1024 << " KB for " << count_bits << " bits" << std::endl;
+
+    double  start = bench::now();
+
+    for (int r = 0; r < reps; ++r)
+        checksum += count(lhs);
+
+    double  elapsed = bench::now() - start;
+
+    std::cout << "  count     " << count_bits * reps / elapsed / 1e9 << " Gbit/s" << std::endl;
+    start = bench::now();
+    for (int r = 0; r < reps; ++r)
+        checksum += find_all(lhs);
+    elapsed = bench::now() - start;
+    std::cout << "  find_set  " << count_bits * reps / elapsed / 1e9 << " Gbit/s" << std::endl;
+    start = bench::now();
+    for (int r = 0; r < reps; ++r)
+        lhs.flip();
+    elapsed = bench::now() - start;
+    std::cout << "  flip      " << count_bits * reps / elapsed / 1e9 << " Gbit/s" << std::endl;
+    for (int operation = 0; operation < 3; ++operation)
+    {
+        start = bench::now();
+        for (int r = 0; r < reps; ++r)
+            combine(lhs, rhs, operation);
+        elapsed = bench::now() - start;
+        std::cout << "  " << operations[operation] << (operation == 1 ? "        " : "       ")
+                  << count_bits * reps / elapsed / 1e9 << " Gbit/s" << std::endl;
+    }
+    checksum += count(lhs);
+    std::cout << "  checksum " << checksum << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    size_t  count_bits = argc > 1 ? (size_t)strtod(argv[1], 0) : 100000000;
+    int     reps = argc > 2 ? atoi(argv[2]) : 10;
+
+    run<ft::vector<bool> >("ft::vector<bool>", count_bits, reps);
+    run<std::vector<bool> >("std::vector<bool>", count_bits, reps);
+    return 0;
+}
@@ -0,0 +1,334 @@
+#ifndef BUFFERED_MAP_HPP
+#define BUFFERED_MAP_HPP
+
+#include <memory>
+#include "../utilities/utilities.hpp"
+#include "../map/map.hpp"
+#include "../vector/vector.hpp"
+
+namespace ft
+{
+    template<class Key, class T, class Compare = ft::less<Key>, class Allocator = std::allocator<ft::pair<const Key, T> > >
+    class buffered_map
+    {
+    public:
+        typedef Key                                                             key_type;
+        typedef T                                                               mapped_type;
+        typedef ft::pair<const Key, T>                                          value_type;
+        typedef Compare                                                         key_compare;
+        typedef Allocator                                                       allocator_type;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef ft::map<Key, T, Compare, Allocator>                             tree_type;
+
+        struct entry
+        {
+            value_type  value;
+            bool        erased;
+
+            entry(const value_type &entry_value, bool entry_erased) : value(entry_value), erased(entry_erased) {}
+        };
+
+        typedef typename Allocator::template rebind<entry>::other               entry_allocator_type;
+        typedef typename Allocator::template rebind<size_type>::other           index_allocator_type;
+        typedef ft::vector<entry, entry_allocator_type>                         buffer_type;
+        typedef ft::vector<size_type, index_allocator_type>                     index_type;
+
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag       iterator_category;
+            typedef typename buffered_map::value_type   value_type;
+            typedef std::ptrdiff_t                  difference_type;
+            typedef const value_type                *pointer;
+            typedef const value_type                &reference;
+
+            const_iterator() : _buffer(0), _index(0), _pos(0), _last(0), _from_buffer(false) {}
+
+            const_iterator(typename tree_type::const_iterator tree_it, typename tree_type::const_iterator tree_end,
+                           const entry *buffer, const size_type *index, size_type pos, size_type last,
+                           const key_compare &comparator)
+                : _tree_it(tree_it), _tree_end(tree_end), _buffer(buffer), _index(index), _pos(pos), _last(last),
+                  _compare(comparator)
+            {
+                settle();
+            }
+
+            reference   operator*() const
+            {
+                return _from_buffer ? _buffer[_index[_pos]].value : *_tree_it;
+            }
+
+            pointer     operator->() const
+            {
+                return &(operator*());
+            }
+
+            const_iterator  &operator++()
+            {
+                if (_from_buffer)
+                    skip_buffer();
+                else
+                    ++_tree_it;
+                settle();
+                return *this;
+            }
+
+            const_iterator  operator++(int)
+            {
+                const_iterator  tmp = *this;
+                ++(*this);
+                return tmp;
+            }
+
+            bool    operator==(const const_iterator &it) const
+            {
+                return _tree_it == it._tree_it && _pos == it._pos;
+            }
+
+            bool    operator!=(const const_iterator &it) const
+            {
+                return !(*this == it);
+            }
+
+        private:
+            typename tree_type::const_iterator  _tree_it;
+            typename tree_type::const_iterator  _tree_end;
+            const entry                         *_buffer;
+            const size_type                     *_index;
+            size_type                           _pos;
+            size_type                           _last;
+            bool                                _from_buffer;
+            key_compare                         _compare;
+
+            void    skip_buffer()
+            {
+                if (_tree_it != _tree_end && !_compare(_buffer[_index[_pos]].value.first, _tree_it->first))
+                    ++_tree_it;
+                ++_pos;
+            }
+
+            void    settle()
+            {
+                while (_pos != _last)
+                {
+                    const entry &current = _buffer[_index[_pos]];
+
+                    if (_tree_it != _tree_end && _compare(_tree_it->first, current.value.first))
+                        break;
+                    if (!current.erased)
+                        break;
+                    skip_buffer();
+                }
+                _from_buffer = _pos != _last &&
+                    (_tree_it == _tree_end || !_compare(_tree_it->first, _buffer[_index[_pos]].value.first));
+            }
+        };
+
+        typedef const_iterator                                                  iterator;
+
+        explicit    buffered_map(size_type buffer_capacity = 128, const key_compare &comparator = key_compare(),
+                                 const allocator_type &allocator = allocator_type())
+            : _tree(comparator, allocator), _buffer(entry_allocator_type(allocator)),
+              _index(index_allocator_type(allocator)), _buffer_capacity(buffer_capacity ? buffer_capacity : 1),
+              _size(0), _compare(comparator)
+        {
+            _buffer.reserve(_buffer_capacity);
+            _index.reserve(_buffer_capacity);
+        }
+
+        ~buffered_map() {}
+
+        void    insert(const value_type &value)
+        {
+            size_type   pos = lower_bound(value.first);
+
+            if (pos != _index.size() && !_compare(value.first, _buffer[_index[pos]].value.first))
+            {
+                entry   &current = _buffer[_index[pos]];
+
+                _size += current.erased;
+                current.value.second = value.second;
+                current.erased = false;
+                return;
+            }
+            if (_buffer.size() >= _buffer_capacity)
+            {
+                compact();
+                pos = 0;
+            }
+            _size += !_tree.count(value.first);
+            _index.insert(_index.begin() + pos, _buffer.size());
+            _buffer.push_back(entry(value, false));
+        }
+
+        void    erase(const key_type &key)
+        {
+            size_type   pos = lower_bound(key);
+
+            if (pos != _index.size() && !_compare(key, _buffer[_index[pos]].value.first))
+            {
+                entry   &current = _buffer[_index[pos]];
+
+                _size -= !current.erased;
+                current.erased = true;
+                return;
+            }
+            if (!_tree.count(key))
+                return;
+            if (_buffer.size() >= _buffer_capacity)
+            {
+                compact();
+                pos = 0;
+            }
+            --_size;
+            _index.insert(_index.begin() + pos, _buffer.size());
+            _buffer.push_back(entry(value_type(key, mapped_type()), true));
+        }
+
+        const mapped_type   *find(const key_type &key) const
+        {
+            size_type   pos = lower_bound(key);
+
+            if (pos != _index.size() && !_compare(key, _buffer[_index[pos]].value.first))
+            {
+                const entry &current = _buffer[_index[pos]];
+
+                return current.erased ? 0 : &current.value.second;
+            }
+
+            typename tree_type::const_iterator  it = _tree.find(key);
+
+            return it == _tree.end() ? 0 : &it->second;
+        }
+
+        size_type   count(const key_type &key) const
+        {
+            return find(key) ? 1 : 0;
+        }
+
+        const_iterator  begin() const
+        {
+            return const_iterator(_tree.begin(), _tree.end(), buffer_data(), index_data(), 0, _index.size(), _compare);
+        }
+
+        const_iterator  end() const
+        {
+            return const_iterator(_tree.end(), _tree.end(), buffer_data(), index_data(),
+                                  _index.size(), _index.size(), _compare);
+        }
+
+        void    flush()
+        {
+            compact();
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        bool    empty() const
+        {
+            return !_size;
+        }
+
+        void    clear()
+        {
+            _buffer.clear();
+            _index.clear();
+            _tree.clear();
+            _size = 0;
+        }
+
+        size_type   buffer_size() const
+        {
+            return _buffer.size();
+        }
+
+        size_type   buffer_capacity() const
+        {
+            return _buffer_capacity;
+        }
+
+        key_compare key_comp() const
+        {
+            return _compare;
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            memory_footprint    usage = _tree.memory_usage();
+            size_type           pending = _buffer.size();
+
+            usage += memory_footprint(pending, pending * sizeof(value_type),
+                                      sizeof(*this) - sizeof(_tree) + _buffer.capacity() * sizeof(entry)
+                                      + _index.capacity() * sizeof(size_type));
+            return usage;
+        }
+
+    private:
+        tree_type   _tree;
+        buffer_type _buffer;
+        index_type  _index;
+        size_type   _buffer_capacity;
+        size_type   _size;
+        key_compare _compare;
+
+        buffered_map(const buffered_map &);
+        buffered_map    &operator=(const buffered_map &);
+
+        const entry *buffer_data() const
+        {
+            return _buffer.empty() ? 0 : &_buffer[0];
+        }
+
+        const size_type *index_data() const
+        {
+            return _index.empty() ? 0 : &_index[0];
+        }
+
+        size_type   lower_bound(const key_type &key) const
+        {
+            size_type   first = 0;
+            size_type   last = _index.size();
+
+            while (first < last)
+            {
+                size_type   middle = first + (last - first) / 2;
+
+                if (_compare(_buffer[_index[middle]].value.first, key))
+                    first = middle + 1;
+                else
+                    last = middle;
+            }
+            return first;
+        }
+
+        void    compact()
+        {
+            if (_buffer.empty())
+                return;
+
+            typename tree_type::cursor  cursor(_tree);
+
+            for (size_type i = 0; i < _index.size(); ++i)
+            {
+                const entry &current = _buffer[_index[i]];
+
+                if (current.erased)
+                    cursor.erase(current.value.first);
+                else
+                {
+                    ft::pair<typename tree_type::iterator, bool>    result = cursor.insert(current.value);
+
+                    if (!result.second)
+                        result.first->second = current.value.second;
+                }
+            }
+            _buffer.clear();
+            _index.clear();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,527 @@
+#ifndef DEQUE_HPP
+#define DEQUE_HPP
+
+#include <memory>
+#include "../iterator/deque_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+
+namespace ft
+{
+    template <class T, class Allocator = std::allocator<T> >
+    class deque
+    {
+    public:
+        typedef T                                                       value_type;
+        typedef Allocator                                               allocator_type;
+        typedef typename allocator_type::size_type                      size_type;
+        typedef typename allocator_type::reference                      reference;
+        typedef typename allocator_type::const_reference                const_reference;
+        typedef typename allocator_type::pointer                        pointer;
+        typedef typename allocator_type::const_pointer                  const_pointer;
+        typedef ft::deque_iterator<value_type>                          iterator;
+        typedef ft::deque_iterator<const value_type>                    const_iterator;
+        typedef ft::reverse_iterator<iterator>                          reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                    const_reverse_iterator;
+        typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+        typedef typename Allocator::template rebind<pointer>::other     map_allocator_type;
+
+        static const difference_type    block_size = ft::deque_block<value_type>::size;
+
+        explicit    deque(const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _map_allocator(alloc), _map(0), _map_size(0), _offset(0), _size(0) {}
+
+        explicit    deque(size_type size, const value_type &value = value_type(),
+                          const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _map_allocator(alloc), _map(0), _map_size(0), _offset(0), _size(0)
+        {
+            assign(size, value);
+        }
+
+        template <class InputIterator>
+        deque(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+              typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+            : _allocator(alloc), _map_allocator(alloc), _map(0), _map_size(0), _offset(0), _size(0)
+        {
+            assign(first, last);
+        }
+
+        deque(const deque &other)
+            : _allocator(other._allocator), _map_allocator(other._map_allocator), _map(0), _map_size(0), _offset(0), _size(0),
+              _shrink_policy(other._shrink_policy)
+        {
+            assign(other.begin(), other.end());
+        }
+
+        ~deque()
+        {
+            clear();
+            release_map();
+        }
+
+        deque   &operator=(const deque &other)
+        {
+            if (this != &other)
+            {
+                _shrink_policy = other._shrink_policy;
+                assign(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        void    assign(size_type size, const value_type &value)
+        {
+            clear();
+            for (size_type i = 0; i < size; ++i)
+                push_back(value);
+        }
+
+        template <class InputIterator>
+        void    assign(InputIterator first, InputIterator last,
+                       typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        iterator        begin()
+        {
+            return iterator(_map, _offset);
+        }
+
+        const_iterator  begin() const
+        {
+            return const_iterator(_map, _offset);
+        }
+
+        iterator        end()
+        {
+            return iterator(_map, _offset + _size);
+        }
+
+        const_iterator  end() const
+        {
+            return const_iterator(_map, _offset + _size);
+        }
+
+        reverse_iterator        rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator        rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        size_type   max_size() const
+        {
+            return _allocator.max_size();
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            size_type   blocks = 0;
+
+            for (size_type i = 0; i < _map_size; ++i)
+                blocks += _map[i] != 0;
+            return memory_footprint(_size, _size * sizeof(value_type),
+                                    sizeof(*this) + _map_size * sizeof(pointer) + blocks * block_size * sizeof(value_type));
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        void        resize(size_type new_size, value_type value = value_type())
+        {
+            while (_size > new_size)
+                pop_back();
+            while (_size < new_size)
+                push_back(value);
+        }
+
+        reference       operator[](size_type pos)
+        {
+            return at_index(_offset + pos);
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            return at_index(_offset + pos);
+        }
+
+        reference       at(size_type pos)
+        {
+            if (pos < _size)
+                return (*this)[pos];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos < _size)
+                return (*this)[pos];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        reference       front()
+        {
+            return at_index(_offset);
+        }
+
+        const_reference front() const
+        {
+            return at_index(_offset);
+        }
+
+        reference       back()
+        {
+            return at_index(_offset + _size - 1);
+        }
+
+        const_reference back() const
+        {
+            return at_index(_offset + _size - 1);
+        }
+
+        void    push_back(const value_type &value)
+        {
+            size_type   index = _offset + _size;
+
+            if (index == _map_size * block_size)
+            {
+                grow_map();
+                index = _offset + _size;
+            }
+            if (!_map[index / block_size])
+                _map[index / block_size] = _allocator.allocate(block_size);
+            _allocator.construct(&at_index(index), value);
+            ++_size;
+        }
+
+        void    push_front(const value_type &value)
+        {
+            if (!_offset)
+                grow_map();
+
+            size_type   index = _offset - 1;
+
+            if (!_map[index / block_size])
+                _map[index / block_size] = _allocator.allocate(block_size);
+            _allocator.construct(&at_index(index), value);
+            _offset = index;
+            ++_size;
+        }
+
+        void    pop_back()
+        {
+            if (_size)
+            {
+                --_size;
+                _allocator.destroy(&at_index(_offset + _size));
+                if (!((_offset + _size) % block_size))
+                {
+                    if ((_offset + _size) / block_size + 1 < _map_size)
+                        release_block((_offset + _size) / block_size + 1);
+                    apply_shrink_policy();
+                }
+            }
+        }
+
+        void    pop_front()
+        {
+            if (_size)
+            {
+                _allocator.destroy(&at_index(_offset));
+                ++_offset;
+                --_size;
+                if (!(_offset % block_size))
+                {
+                    if (_offset / block_size >= 2)
+                        release_block(_offset / block_size - 2);
+                    apply_shrink_policy();
+                }
+            }
+        }
+
+        iterator    insert(iterator pos, const value_type &value)
+        {
+            difference_type index = pos - begin();
+            value_type      copy(value);
+
+            open_gap(index, 1, copy);
+            (*this)[index] = copy;
+            return begin() + index;
+        }
+
+        void        insert(iterator pos, size_type count, const value_type &value)
+        {
+            difference_type index = pos - begin();
+            value_type      copy(value);
+
+            if (!count)
+                return;
+            open_gap(index, count, copy);
+            for (size_type i = 0; i < count; ++i)
+                (*this)[index + i] = copy;
+        }
+
+        template <class InputIterator>
+        void        insert(iterator pos, InputIterator first, InputIterator last,
+                           typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            difference_type index = pos - begin();
+            deque           values(first, last, _allocator);
+
+            if (values.empty())
+                return;
+            open_gap(index, values.size(), values.front());
+            for (size_type i = 0; i < values.size(); ++i)
+                (*this)[index + i] = values[i];
+        }
+
+        iterator    erase(iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator    erase(iterator first, iterator last)
+        {
+            difference_type index = first - begin();
+            difference_type count = last - first;
+
+            if (!count)
+                return first;
+            if (index < (difference_type)(_size - count) / 2)
+            {
+                for (difference_type i = index - 1; i >= 0; --i)
+                    (*this)[i + count] = (*this)[i];
+                for (difference_type i = 0; i < count; ++i)
+                    pop_front();
+            }
+            else
+            {
+                for (difference_type i = index; i + count < (difference_type)_size; ++i)
+                    (*this)[i] = (*this)[i + count];
+                for (difference_type i = 0; i < count; ++i)
+                    pop_back();
+            }
+            return begin() + index;
+        }
+
+        void    clear()
+        {
+            while (_size)
+                pop_back();
+            apply_shrink_policy();
+        }
+
+        void    shrink_to_fit()
+        {
+            size_type   used = used_blocks();
+
+            if (!_size)
+            {
+                release_map();
+                _offset = 0;
+            }
+            else if (_map_size > (used + 1) * 2 && _map_size > 8)
+                grow_map();
+        }
+
+        // With a policy enabled, pop_back, pop_front and clear may move the block map.
+        // That invalidates every iterator; references to the remaining elements stay valid.
+        void    set_shrink_policy(const shrink_policy &policy)
+        {
+            _shrink_policy = policy;
+            apply_shrink_policy();
+        }
+
+        shrink_policy   get_shrink_policy() const
+        {
+            return _shrink_policy;
+        }
+
+        void    swap(deque &other)
+        {
+            ft::swap(_allocator, other._allocator);
+            ft::swap(_map_allocator, other._map_allocator);
+            ft::swap(_map, other._map);
+            ft::swap(_map_size, other._map_size);
+            ft::swap(_offset, other._offset);
+            ft::swap(_size, other._size);
+            ft::swap(_shrink_policy, other._shrink_policy);
+        }
+
+        allocator_type  get_allocator() const
+        {
+            return _allocator;
+        }
+
+    private:
+        allocator_type      _allocator;
+        map_allocator_type  _map_allocator;
+        pointer             *_map;
+        size_type           _map_size;
+        size_type           _offset;
+        size_type           _size;
+        shrink_policy       _shrink_policy;
+
+        reference   at_index(size_type index) const
+        {
+            return _map[index / block_size][index % block_size];
+        }
+
+        void    open_gap(difference_type index, size_type count, const value_type &fill)
+        {
+            if (index < (difference_type)_size / 2)
+            {
+                for (size_type i = 0; i < count; ++i)
+                    push_front(fill);
+                for (difference_type i = 0; i < index; ++i)
+                    (*this)[i] = (*this)[i + count];
+            }
+            else
+            {
+                for (size_type i = 0; i < count; ++i)
+                    push_back(fill);
+                for (difference_type i = _size - 1; i >= index + (difference_type)count; --i)
+                    (*this)[i] = (*this)[i - count];
+            }
+        }
+
+        void    release_block(size_type block)
+        {
+            if (_map[block])
+            {
+                _allocator.deallocate(_map[block], block_size);
+                _map[block] = 0;
+            }
+        }
+
+        void    release_map()
+        {
+            if (_map)
+            {
+                for (size_type i = 0; i < _map_size; ++i)
+                    release_block(i);
+                _map_allocator.deallocate(_map, _map_size);
+            }
+            _map = 0;
+            _map_size = 0;
+        }
+
+        size_type   used_blocks() const
+        {
+            return _size ? (_offset + _size - 1) / block_size - _offset / block_size + 1 : 0;
+        }
+
+        void    apply_shrink_policy()
+        {
+            if (_shrink_policy.enabled())
+            {
+                size_type   target = _shrink_policy.target(_size, _map_size * block_size);
+                size_type   blocks = (target + block_size - 1) / block_size;
+
+                if (blocks < used_blocks() + 2)
+                    blocks = used_blocks() + 2;
+                if (!target)
+                {
+                    release_map();
+                    _offset = 0;
+                }
+                else if (blocks < _map_size)
+                    relocate_map(blocks);
+            }
+        }
+
+        void    grow_map()
+        {
+            size_type   used = used_blocks();
+
+            relocate_map((used + 1) * 2 > 8 ? (used + 1) * 2 : 8);
+        }
+
+        void    relocate_map(size_type new_size)
+        {
+            size_type   first = _offset / block_size;
+            size_type   used = used_blocks();
+            pointer     *new_map = _map_allocator.allocate(new_size);
+            size_type   new_first = (new_size - used) / 2;
+
+            for (size_type i = 0; i < new_size; ++i)
+                new_map[i] = 0;
+            for (size_type i = 0; i < used; ++i)
+            {
+                new_map[new_first + i] = _map[first + i];
+                _map[first + i] = 0;
+            }
+            release_map();
+            _map = new_map;
+            _map_size = new_size;
+            _offset = new_first * block_size + (_size ? _offset % block_size : 0);
+        }
+    };
+
+    template<class T, class Allocator>
+    bool    operator==(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<class T, class Allocator>
+    bool    operator!=(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class T, class Allocator>
+    bool    operator<(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template<class T, class Allocator>
+    bool    operator<=(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template<class T, class Allocator>
+    bool    operator>(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template<class T, class Allocator>
+    bool    operator>=(const ft::deque<T, Allocator> &lhs, const ft::deque<T, Allocator> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    template<class T, class Allocator>
+    void    swap(ft::deque<T, Allocator> &lhs, ft::deque<T, Allocator> &rhs)
+    {
+        lhs.swap(rhs);
+    }
+}
+
+#endif
@@ -0,0 +1,222 @@
+#ifndef BIT_ITERATOR_HPP
+#define BIT_ITERATOR_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+    class bit_reference
+    {
+    public:
+        bit_reference(uint64_t *word, uint64_t mask) : _word(word), _mask(mask) {}
+
+        bit_reference(const bit_reference &other) : _word(other._word), _mask(other._mask) {}
+
+        operator bool() const
+        {
+            return (*_word & _mask) != 0;
+        }
+
+        bool    operator~() const
+        {
+            return !(*_word & _mask);
+        }
+
+        bit_reference   &operator=(bool value)
+        {
+            if (value)
+                *_word |= _mask;
+            else
+                *_word &= ~_mask;
+            return *this;
+        }
+
+        bit_reference   &operator=(const bit_reference &other)
+        {
+            return *this = (bool)other;
+        }
+
+        void    flip()
+        {
+            *_word ^= _mask;
+        }
+
+    private:
+        uint64_t    *_word;
+        uint64_t    _mask;
+    };
+
+    inline void swap(bit_reference lhs, bit_reference rhs)
+    {
+        bool    value = lhs;
+
+        lhs = (bool)rhs;
+        rhs = value;
+    }
+
+    template <class Word>
+    struct bit_access
+    {
+        typedef bit_reference   reference;
+
+        static reference    get(Word *words, size_t index)
+        {
+            return reference(words + index / 64, (uint64_t)1 << (index % 64));
+        }
+    };
+
+    template <class Word>
+    struct bit_access<const Word>
+    {
+        typedef bool    reference;
+
+        static reference    get(const Word *words, size_t index)
+        {
+            return (words[index / 64] >> (index % 64)) & 1;
+        }
+    };
+
+    template <class Word>
+    class bit_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag                 iterator_category;
+        typedef bool                                            value_type;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef void                                            pointer;
+        typedef typename bit_access<Word>::reference            reference;
+
+        bit_iterator() : _words(0), _index(0) {}
+
+        bit_iterator(Word *words, size_t index) : _words(words), _index(index) {}
+
+        template <class Other>
+        bit_iterator(const bit_iterator<Other> &other) : _words(other.words()), _index(other.index()) {}
+
+        reference   operator*() const
+        {
+            return bit_access<Word>::get(_words, _index);
+        }
+
+        reference   operator[](difference_type n) const
+        {
+            return bit_access<Word>::get(_words, _index + n);
+        }
+
+        bit_iterator    &operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        bit_iterator    operator++(int)
+        {
+            bit_iterator    tmp = *this;
+
+            ++_index;
+            return tmp;
+        }
+
+        bit_iterator    &operator--()
+        {
+            --_index;
+            return *this;
+        }
+
+        bit_iterator    operator--(int)
+        {
+            bit_iterator    tmp = *this;
+
+            --_index;
+            return tmp;
+        }
+
+        bit_iterator    &operator+=(difference_type n)
+        {
+            _index += n;
+            return *this;
+        }
+
+        bit_iterator    &operator-=(difference_type n)
+        {
+            _index -= n;
+            return *this;
+        }
+
+        bit_iterator    operator+(difference_type n) const
+        {
+            return bit_iterator(_words, _index + n);
+        }
+
+        bit_iterator    operator-(difference_type n) const
+        {
+            return bit_iterator(_words, _index - n);
+        }
+
+        Word    *words() const
+        {
+            return _words;
+        }
+
+        size_t  index() const
+        {
+            return _index;
+        }
+
+    private:
+        Word    *_words;
+        size_t  _index;
+    };
+
+    template <class Word>
+    bit_iterator<Word>  operator+(typename bit_iterator<Word>::difference_type n, const bit_iterator<Word> &it)
+    {
+        return it + n;
+    }
+
+    template <class Lhs, class Rhs>
+    std::ptrdiff_t  operator-(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return (std::ptrdiff_t)lhs.index() - (std::ptrdiff_t)rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator==(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() == rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator!=(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() != rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator<(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() < rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator<=(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() <= rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator>(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() > rhs.index();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator>=(const bit_iterator<Lhs> &lhs, const bit_iterator<Rhs> &rhs)
+    {
+        return lhs.index() >= rhs.index();
+    }
+}
+
+#endif
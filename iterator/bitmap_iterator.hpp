@@ -0,0 +1,88 @@
+#ifndef BITMAP_ITERATOR_HPP
+#define BITMAP_ITERATOR_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+    template <class Set>
+    class bitmap_iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag         iterator_category;
+        typedef typename Set::value_type                value_type;
+        typedef std::ptrdiff_t                          difference_type;
+        typedef void                                    pointer;
+        typedef value_type                              reference;
+
+        bitmap_iterator() : _set(0), _chunk(0), _slot(0), _low(0) {}
+
+        bitmap_iterator(const Set *set, size_t chunk, size_t slot, uint32_t low)
+            : _set(set), _chunk(chunk), _slot(slot), _low(low) {}
+
+        reference   operator*() const
+        {
+            return _set->value_at(_chunk, _low);
+        }
+
+        bitmap_iterator &operator++()
+        {
+            _set->step_forward(_chunk, _slot, _low);
+            return *this;
+        }
+
+        bitmap_iterator operator++(int)
+        {
+            bitmap_iterator tmp = *this;
+
+            _set->step_forward(_chunk, _slot, _low);
+            return tmp;
+        }
+
+        bitmap_iterator &operator--()
+        {
+            _set->step_backward(_chunk, _slot, _low);
+            return *this;
+        }
+
+        bitmap_iterator operator--(int)
+        {
+            bitmap_iterator tmp = *this;
+
+            _set->step_backward(_chunk, _slot, _low);
+            return tmp;
+        }
+
+        size_t      chunk() const
+        {
+            return _chunk;
+        }
+
+        uint32_t    low() const
+        {
+            return _low;
+        }
+
+    private:
+        const Set   *_set;
+        size_t      _chunk;
+        size_t      _slot;
+        uint32_t    _low;
+    };
+
+    template <class Set>
+    bool    operator==(const bitmap_iterator<Set> &lhs, const bitmap_iterator<Set> &rhs)
+    {
+        return lhs.chunk() == rhs.chunk() && lhs.low() == rhs.low();
+    }
+
+    template <class Set>
+    bool    operator!=(const bitmap_iterator<Set> &lhs, const bitmap_iterator<Set> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif
@@ -0,0 +1,170 @@
+#ifndef DEQUE_ITERATOR_HPP
+#define DEQUE_ITERATOR_HPP
+
+#include "iterator_traits.hpp"
+#include "../utilities/switch_const.hpp"
+
+namespace ft
+{
+    template <class T>
+    struct deque_block
+    {
+        static const std::ptrdiff_t size = sizeof(T) <= 256 ? 4096 / sizeof(T) : 16;
+    };
+
+    template <typename T>
+    class deque_iterator
+    {
+    public:
+        typedef typename ft::iterator<std::random_access_iterator_tag, T>   dit;
+        typedef typename dit::iterator_category                             iterator_category;
+        typedef typename dit::value_type                                    value_type;
+        typedef typename dit::difference_type                               difference_type;
+        typedef T                                                           *pointer;
+        typedef T                                                           &reference;
+        typedef typename ft::switch_const<T>::type                          *block_pointer;
+
+        deque_iterator() : _map(0), _index(0) {}
+
+        deque_iterator(block_pointer *map, difference_type index) : _map(map), _index(index) {}
+
+        deque_iterator(const deque_iterator &src) : _map(src._map), _index(src._index) {}
+
+        ~deque_iterator() {}
+
+        deque_iterator  &operator=(const deque_iterator &src)
+        {
+            _map = src._map;
+            _index = src._index;
+            return *this;
+        }
+
+        reference   operator*() const
+        {
+            return _map[_index / ft::deque_block<T>::size][_index % ft::deque_block<T>::size];
+        }
+
+        pointer     operator->() const
+        {
+            return &(operator*());
+        }
+
+        deque_iterator  operator+(difference_type t) const
+        {
+            return deque_iterator(_map, _index + t);
+        }
+
+        deque_iterator  &operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        deque_iterator  operator++(int)
+        {
+            deque_iterator  tmp = *this;
+            ++_index;
+            return tmp;
+        }
+
+        deque_iterator  &operator+=(difference_type t)
+        {
+            _index += t;
+            return *this;
+        }
+
+        deque_iterator  operator-(difference_type t) const
+        {
+            return deque_iterator(_map, _index - t);
+        }
+
+        deque_iterator  &operator--()
+        {
+            --_index;
+            return *this;
+        }
+
+        deque_iterator  operator--(int)
+        {
+            deque_iterator  tmp = *this;
+            --_index;
+            return tmp;
+        }
+
+        deque_iterator  &operator-=(difference_type t)
+        {
+            _index -= t;
+            return *this;
+        }
+
+        reference   operator[](difference_type t) const
+        {
+            return *(*this + t);
+        }
+
+        operator    deque_iterator<const T>() const
+        {
+            return deque_iterator<const T>(_map, _index);
+        }
+
+        difference_type index() const
+        {
+            return _index;
+        }
+
+    private:
+        block_pointer   *_map;
+        difference_type _index;
+    };
+
+    template<class Iter1, class Iter2>
+    bool    operator==(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() == rhs.index();
+    }
+
+    template<class Iter1, class Iter2>
+    bool    operator!=(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() != rhs.index();
+    }
+
+    template<class Iter1, class Iter2>
+    bool    operator<(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() < rhs.index();
+    }
+
+    template<class Iter1, class Iter2>
+    bool    operator<=(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() <= rhs.index();
+    }
+
+    template<class Iter1, class Iter2>
+    bool    operator>(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() > rhs.index();
+    }
+
+    template<class Iter1, class Iter2>
+    bool    operator>=(const deque_iterator<Iter1> &lhs, const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() >= rhs.index();
+    }
+
+    template<class Iter>
+    deque_iterator<Iter>    operator+(typename deque_iterator<Iter>::difference_type t, const deque_iterator<Iter> &it)
+    {
+        return it + t;
+    }
+
+    template<class Iter1, class Iter2>
+    typename deque_iterator<Iter1>::difference_type operator-(const deque_iterator<Iter1> &lhs,
+            const deque_iterator<Iter2> &rhs)
+    {
+        return lhs.index() - rhs.index();
+    }
+}
+
+#endif
@@ -0,0 +1,143 @@
+#ifndef PACKED_ITERATOR_HPP
+#define PACKED_ITERATOR_HPP
+
+#include <cstddef>
+#include "iterator_traits.hpp"
+
+namespace ft
+{
+    template <class Container>
+    class packed_iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag         iterator_category;
+        typedef typename Container::value_type          value_type;
+        typedef std::ptrdiff_t                          difference_type;
+        typedef const value_type                        *pointer;
+        typedef value_type                              reference;
+
+        packed_iterator() : _container(0), _index(0) {}
+
+        packed_iterator(const Container *container, size_t index) : _container(container), _index(index) {}
+
+        reference   operator*() const
+        {
+            return _container->decoded(_index);
+        }
+
+        reference   operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        packed_iterator &operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        packed_iterator operator++(int)
+        {
+            packed_iterator tmp = *this;
+
+            ++_index;
+            return tmp;
+        }
+
+        packed_iterator &operator--()
+        {
+            --_index;
+            return *this;
+        }
+
+        packed_iterator operator--(int)
+        {
+            packed_iterator tmp = *this;
+
+            --_index;
+            return tmp;
+        }
+
+        packed_iterator &operator+=(difference_type n)
+        {
+            _index += n;
+            return *this;
+        }
+
+        packed_iterator &operator-=(difference_type n)
+        {
+            _index -= n;
+            return *this;
+        }
+
+        packed_iterator operator+(difference_type n) const
+        {
+            return packed_iterator(_container, _index + n);
+        }
+
+        packed_iterator operator-(difference_type n) const
+        {
+            return packed_iterator(_container, _index - n);
+        }
+
+        size_t  index() const
+        {
+            return _index;
+        }
+
+    private:
+        const Container *_container;
+        size_t          _index;
+    };
+
+    template <class Container>
+    packed_iterator<Container>  operator+(typename packed_iterator<Container>::difference_type n,
+                                          const packed_iterator<Container> &it)
+    {
+        return it + n;
+    }
+
+    template <class Container>
+    std::ptrdiff_t  operator-(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return (std::ptrdiff_t)lhs.index() - (std::ptrdiff_t)rhs.index();
+    }
+
+    template <class Container>
+    bool    operator==(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() == rhs.index();
+    }
+
+    template <class Container>
+    bool    operator!=(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() != rhs.index();
+    }
+
+    template <class Container>
+    bool    operator<(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() < rhs.index();
+    }
+
+    template <class Container>
+    bool    operator>(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() > rhs.index();
+    }
+
+    template <class Container>
+    bool    operator<=(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() <= rhs.index();
+    }
+
+    template <class Container>
+    bool    operator>=(const packed_iterator<Container> &lhs, const packed_iterator<Container> &rhs)
+    {
+        return lhs.index() >= rhs.index();
+    }
+}
+
+#endif
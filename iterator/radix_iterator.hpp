@@ -0,0 +1,107 @@
+#ifndef RADIX_ITERATOR_HPP
+#define RADIX_ITERATOR_HPP
+
+#include <string>
+#include "iterator_traits.hpp"
+#include "../utilities/switch_const.hpp"
+
+namespace ft
+{
+    struct radix_link
+    {
+        radix_link  *prev;
+        radix_link  *next;
+
+        radix_link() : prev(this), next(this) {}
+    };
+
+    template <class T>
+    struct radix_leaf : radix_link
+    {
+        T           value;
+        std::string key;
+
+        radix_leaf(const T &leaf_value, const std::string &bytes) : value(leaf_value), key(bytes) {}
+    };
+
+    template <class T>
+    class radix_iterator
+    {
+    public:
+        typedef std::bidirectional_iterator_tag                         iterator_category;
+        typedef T                                                       value_type;
+        typedef std::ptrdiff_t                                          difference_type;
+        typedef T                                                       *pointer;
+        typedef T                                                       &reference;
+        typedef radix_leaf<typename ft::switch_const<T>::type>          leaf_type;
+
+        radix_iterator() : _link(0) {}
+
+        explicit radix_iterator(radix_link *link) : _link(link) {}
+
+        reference   operator*() const
+        {
+            return static_cast<leaf_type *>(_link)->value;
+        }
+
+        pointer     operator->() const
+        {
+            return &static_cast<leaf_type *>(_link)->value;
+        }
+
+        radix_iterator  &operator++()
+        {
+            _link = _link->next;
+            return *this;
+        }
+
+        radix_iterator  operator++(int)
+        {
+            radix_iterator  tmp = *this;
+
+            _link = _link->next;
+            return tmp;
+        }
+
+        radix_iterator  &operator--()
+        {
+            _link = _link->prev;
+            return *this;
+        }
+
+        radix_iterator  operator--(int)
+        {
+            radix_iterator  tmp = *this;
+
+            _link = _link->prev;
+            return tmp;
+        }
+
+        radix_link  *link() const
+        {
+            return _link;
+        }
+
+        operator    radix_iterator<const T>() const
+        {
+            return radix_iterator<const T>(_link);
+        }
+
+    private:
+        radix_link  *_link;
+    };
+
+    template <class Lhs, class Rhs>
+    bool    operator==(const radix_iterator<Lhs> &lhs, const radix_iterator<Rhs> &rhs)
+    {
+        return lhs.link() == rhs.link();
+    }
+
+    template <class Lhs, class Rhs>
+    bool    operator!=(const radix_iterator<Lhs> &lhs, const radix_iterator<Rhs> &rhs)
+    {
+        return lhs.link() != rhs.link();
+    }
+}
+
+#endif
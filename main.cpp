@@ -1,17 +1,55 @@
 #include <iostream>
 #include <string>
-#include <deque>
 #if 1 //CREATE A REAL STL EXAMPLE
+    #include <deque>
     #include <map>
+    #include <set>
     #include <stack>
     #include <vector>
     namespace ft = std;
+    typedef std::map<long, int>             radix_map_long;
+    typedef std::map<std::string, int>      radix_map_string;
+    typedef std::set<unsigned int>          bitmap_set_uint;
+    typedef std::vector<long>               packed_vector_long;
+    typedef std::vector<int>                stable_vector_int;
+    template<typename Container>
+    void use_hysteresis(Container&) {}
+    template<typename Container>
+    void use_bloom_filter(Container&) {}
+    template<typename Container>
+    void use_lookup_cache(Container&) {}
+    template<typename Container>
+    void use_bloom_filter_and_lookup_cache(Container&) {}
 #else
+    #include "deque/deque.hpp"
     #include "map/map.hpp"
+    #include "map/radix_map.hpp"
+    #include "set/bitmap_set.hpp"
 	#include "stack/stack.hpp"
+	#include "vector/packed_vector.hpp"
+	#include "vector/stable_vector.hpp"
 	#include "vector/vector.hpp"
+    typedef ft::radix_map<long, int>        radix_map_long;
+    typedef ft::radix_map<std::string, int> radix_map_string;
+    typedef ft::bitmap_set<unsigned int>    bitmap_set_uint;
+    typedef ft::packed_vector<long>         packed_vector_long;
+    typedef ft::stable_vector<int>          stable_vector_int;
+    template<typename Container>
+    void use_hysteresis(Container& container) { container.set_shrink_policy(ft::shrink_policy::hysteresis()); }
+    template<typename Container>
+    void use_bloom_filter(Container& container) { container.enable_bloom_filter(); }
+    template<typename Container>
+    void use_lookup_cache(Container& container) { container.enable_lookup_cache(256); }
+    template<typename Container>
+    void use_bloom_filter_and_lookup_cache(Container& container)
+    {
+        container.enable_bloom_filter();
+        container.enable_lookup_cache(256);
+    }
 #endif
 
+#include <stdexcept>
+#include <stdio.h>
 #include <stdlib.h>
 
 #define MAX_RAM 4294967296
@@ -44,6 +82,308 @@ public:
     iterator end() { return this->c.end(); }
 };
 
+template<typename Sequence>
+unsigned long sequence_checksum(const Sequence& sequence)
+{
+    unsigned long sum = sequence.size();
+    unsigned long position = 0;
+
+    for (typename Sequence::const_iterator it = sequence.begin(); it != sequence.end(); ++it)
+        sum = sum * 31 + (unsigned long)*it * ++position;
+    return sum;
+}
+
+unsigned long key_checksum(long key)
+{
+    return (unsigned long)key;
+}
+
+unsigned long key_checksum(const std::string& key)
+{
+    unsigned long sum = 0;
+
+    for (size_t i = 0; i < key.size(); ++i)
+        sum = sum * 131 + (unsigned char)key[i];
+    return sum;
+}
+
+template<typename Map>
+unsigned long map_checksum(const Map& map)
+{
+    unsigned long sum = map.size();
+
+    for (typename Map::const_iterator it = map.begin(); it != map.end(); ++it)
+        sum = sum * 31 + key_checksum(it->first) * 7 + (unsigned long)it->second;
+    return sum;
+}
+
+void test_deque()
+{
+    ft::deque<int> deque_int;
+    ft::vector<int> values;
+
+    for (int i = 0; i < 50000; i++)
+    {
+        const int op = rand() % 8;
+        const int first = rand();
+        const int second = rand();
+        const size_t size = deque_int.size();
+        const size_t pos = size ? rand() % (size + 1) : 0;
+
+        if (op == 0)
+            deque_int.push_back(first);
+        else if (op == 1)
+            deque_int.push_front(first);
+        else if (op == 2 && size)
+            deque_int.pop_back();
+        else if (op == 3 && size)
+            deque_int.pop_front();
+        else if (op == 4 && size)
+            deque_int.insert(deque_int.begin() + pos, deque_int[first % size]);
+        else if (op == 5 && size)
+            deque_int.insert(deque_int.begin() + pos, 1 + second % 40, deque_int[first % size]);
+        else if (op == 6)
+        {
+            values.assign(1 + second % 40, first);
+            deque_int.insert(deque_int.begin() + pos, values.begin(), values.end());
+        }
+        else if (op == 7 && size)
+            deque_int.erase(deque_int.begin() + pos, deque_int.begin() + pos + first % (size - pos + 1) / 4);
+        if (deque_int.size() > 20000)
+            deque_int.resize(100);
+    }
+    std::cout << "deque checksum: " << sequence_checksum(deque_int) << std::endl;
+}
+
+void test_shrinking_stack()
+{
+    ft::stack<int> stack;
+    ft::deque<int> queue;
+    unsigned long sum = 0;
+
+    use_hysteresis(stack);
+    use_hysteresis(queue);
+    for (int round = 0; round < 6; round++)
+    {
+        const int count = 1 + rand() % 100000;
+
+        for (int i = 0; i < count; i++)
+        {
+            const int value = rand();
+
+            stack.push(value);
+            queue.push_back(value);
+        }
+        while (stack.size() > (size_t)count / 100)
+        {
+            sum = sum * 31 + (unsigned long)stack.top();
+            stack.pop();
+        }
+        while (queue.size() > (size_t)count / 100)
+        {
+            sum = sum * 31 + (unsigned long)queue.front();
+            queue.pop_front();
+        }
+    }
+    std::cout << "shrinking stack checksum: " << stack.size() << " " << sequence_checksum(queue) << " " << sum << std::endl;
+}
+
+void test_vector_bool()
+{
+    ft::vector<bool> bits;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const int op = rand() % 6;
+        const int first = rand();
+        const bool value = rand() % 2;
+        const size_t size = bits.size();
+        const size_t pos = size ? rand() % (size + 1) : 0;
+
+        if (op == 0)
+            bits.push_back(value);
+        else if (op == 1)
+            bits.insert(bits.begin() + pos, first % 300, value);
+        else if (op == 2 && size)
+            bits.erase(bits.begin() + pos, bits.begin() + pos + first % (size - pos + 1) / 2);
+        else if (op == 3 && size)
+            bits[first % size] = !bits[pos % size];
+        else if (op == 4 && i % 100 == 0)
+            bits.flip();
+        else if (op == 5)
+            bits.resize(first % (size + 100), value);
+    }
+    std::cout << "vector<bool> checksum: " << sequence_checksum(bits) << std::endl;
+}
+
+void test_packed_vector()
+{
+    packed_vector_long packed;
+    long value = -100000;
+    unsigned long sum = 0;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        if ((i / 1000) % 3 == 2)
+            packed.push_back(rand() - RAND_MAX / 2);
+        else
+            packed.push_back(value += rand() % 64);
+    }
+    for (int i = 0; i < 10000; i++)
+        sum = sum * 31 + (unsigned long)packed[rand() % packed.size()];
+    std::cout << "packed_vector checksum: " << sequence_checksum(packed) << " " << sum << std::endl;
+}
+
+void test_bitmap_set()
+{
+    bitmap_set_uint set;
+    unsigned long found = 0;
+
+    for (int i = 0; i < 200000; i++)
+    {
+        const unsigned int chunk = (rand() % 8) << 16;
+        const int op = rand() % 4;
+
+        if (op == 0)
+            set.insert(chunk | (rand() % 6000));
+        else if (op == 1)
+            set.insert(chunk | (rand() % 65536));
+        else if (op == 2)
+            set.erase(chunk | (rand() % 65536));
+        else
+            found += set.count(chunk | (rand() % 65536));
+        if (i % 50000 == 49999)
+            for (unsigned int key = 2 << 16; key < (3 << 16); ++key)
+                set.erase(key);
+    }
+    std::cout << "bitmap_set checksum: " << sequence_checksum(set) << " " << found << std::endl;
+}
+
+void test_radix_map()
+{
+    radix_map_long map_long;
+    radix_map_string map_string;
+    unsigned long found = 0;
+    char buffer[32];
+
+    for (int i = 0; i < 100000; i++)
+    {
+        const long key = (i % 4 == 0) ? (long)rand() << 20 : (long)(rand() % 3000) - 1500;
+        const int op = rand() % 5;
+
+        sprintf(buffer, "key:%d", rand() % (i % 2 ? 300 : 30000));
+        if (op == 0)
+            map_long.insert(ft::make_pair(key, i));
+        else if (op == 1)
+            map_long[key] += i;
+        else if (op == 2)
+            found += map_long.erase(key) + map_string.erase(buffer);
+        else if (op == 3)
+            map_string[buffer] = i;
+        else
+        {
+            radix_map_long::const_iterator it = map_long.lower_bound(key);
+
+            found += map_long.count(key) + map_string.count(buffer);
+            if (it != map_long.end())
+                found += it->second;
+        }
+    }
+    std::cout << "radix_map checksum: " << map_checksum(map_long) << " " << map_checksum(map_string)
+              << " " << found << std::endl;
+}
+
+void test_stable_vector()
+{
+    stable_vector_int vector;
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const int op = rand() % 4;
+        const int first = rand();
+        const int second = rand();
+        const size_t size = vector.size();
+
+        if (op == 0 || !size)
+            vector.push_back(first);
+        else if (op == 1)
+            vector.insert(vector.begin() + first % (size + 1), vector[second % size]);
+        else if (op == 2)
+            vector.erase(vector.begin() + first % size);
+        else
+            vector.resize(first % (size + 50), second);
+    }
+    std::cout << "stable_vector checksum: " << sequence_checksum(vector) << std::endl;
+}
+
+void make_key(int value, int& key)
+{
+    key = value;
+}
+
+void make_key(int value, std::string& key)
+{
+    char buffer[32];
+
+    sprintf(buffer, "id:%d", value);
+    key = buffer;
+}
+
+template<typename Map>
+void test_map_workload(const char* name, void (*configure)(Map&))
+{
+    Map map;
+    unsigned long found = 0;
+    typename Map::key_type key;
+
+    configure(map);
+    for (int i = 0; i < 100000; i++)
+    {
+        const int op = rand() % 10;
+        const int value = rand();
+
+        make_key(rand() % 20000, key);
+        if (op == 0 || op == 1)
+            map.insert(ft::make_pair(key, value));
+        else if (op == 2)
+            map[key] += value;
+        else if (op == 3)
+            found += map.erase(key);
+        else if (op == 4)
+            found += map.count(key);
+        else if (op == 5)
+        {
+            typename Map::const_iterator it = map.find(key);
+
+            if (it != map.end())
+                found += it->second;
+        }
+        else if (op == 6)
+        {
+            try
+            {
+                found += map.at(key);
+            }
+            catch (const std::out_of_range&)
+            {
+                found += 7;
+            }
+        }
+        else if (op == 7 && i % 50 == 0)
+        {
+            Map copy(map);
+
+            found += copy.count(key) + copy.erase(key) + map.count(key);
+            map.swap(copy);
+        }
+        else if (op == 8 && i % 400 == 0)
+            configure(map);
+        else if (op == 9 && i % 5000 == 0)
+            map.clear();
+    }
+    std::cout << name << " checksum: " << map_checksum(map) << " " << found << std::endl;
+}
+
 int main(int argc, char** argv)
 {
     if (argc != 2)
@@ -60,7 +400,7 @@ int main(int argc, char** argv)
     ft::vector<int> vector_int;
     ft::stack<int> stack_int;
     ft::vector<Buffer> vector_buffer;
-    ft::stack<Buffer, std::deque<Buffer> > stack_deq_buffer;
+    ft::stack<Buffer> stack_deq_buffer;
     ft::map<int, int> map_int;
 
     for (int i = 0; i < COUNT; i++)
@@ -113,5 +453,18 @@ int main(int argc, char** argv)
         std::cout << *it;
     }
     std::cout << std::endl;
+
+    test_deque();
+    test_shrinking_stack();
+    test_vector_bool();
+    test_packed_vector();
+    test_bitmap_set();
+    test_radix_map();
+    test_stable_vector();
+    test_map_workload<ft::map<int, int> >("bloom map<int, int>", use_bloom_filter);
+    test_map_workload<ft::map<std::string, int> >("bloom map<string, int>", use_bloom_filter);
+    test_map_workload<ft::map<int, int> >("cached map<int, int>", use_lookup_cache);
+    test_map_workload<ft::map<std::string, int> >("cached map<string, int>", use_lookup_cache);
+    test_map_workload<ft::map<int, int> >("bloom and cached map<int, int>", use_bloom_filter_and_lookup_cache);
     return (0);
 }
\ No newline at end of file
@@ -2,10 +2,16 @@
 #define MAP_HPP
 
 #include <memory>
+#include <type_traits>
 #include "../utilities/utilities.hpp"
 #include "../iterator/red_black_tree_iterator.hpp"
 #include "../iterator/reverse_iterator.hpp"
 #include "../RBTree/red_black_tree.hpp"
+#include "../algorithm/parallel.hpp"
+#include "../utilities/image.hpp"
+#include "../utilities/bloom_filter.hpp"
+#include "../utilities/lookup_cache.hpp"
+#include "../vector/vector.hpp"
 
 namespace ft
 {
@@ -36,19 +42,23 @@ namespace ft
 
         explicit    map(const key_compare &comparator = key_compare(),
                         const allocator_type &allocator = allocator_type())
+            : _tree(node_allocator_type(allocator))
         {
             _allocator = allocator;
             _root_child = _tree.create_node(value_type());
             _key_compare = comparator;
+            _size = 0;
         }
 
         template<class Iter>
         map(Iter first, Iter last, const key_compare &comparator = key_compare(),
             const allocator_type &allocator = allocator_type())
+            : _tree(node_allocator_type(allocator))
         {
             _allocator = allocator;
             _root_child = _tree.create_node(value_type());
             _key_compare = comparator;
+            _size = 0;
             insert(first, last);
         }
 
@@ -58,12 +68,44 @@ namespace ft
             _tree.clear(&_root_child);
         }
 
-        map(const map &other_map)
+        map(const map &other_map) : _tree(node_allocator_type(other_map._allocator))
+        {
+            _allocator = other_map._allocator;
+            _root_child = _tree.create_node(value_type());
+            _key_compare = other_map._key_compare;
+            try
+            {
+                *this = other_map;
+            }
+            catch (...)
+            {
+                _tree.clear(&_root_child->parent);
+                _tree.delete_node(_root_child);
+                throw;
+            }
+        }
+
+        map(const map &other_map, const execution::parallel_policy &policy)
+            : _tree(node_allocator_type(other_map._allocator))
         {
             _allocator = other_map._allocator;
             _root_child = _tree.create_node(value_type());
             _key_compare = other_map._key_compare;
-            *this = other_map;
+            _value_compare = other_map._value_compare;
+            try
+            {
+                _root_child->parent = _tree.parallel_clone(&policy.executor(), other_map._root_child->parent);
+                _size = other_map._size;
+                _bloom = other_map._bloom;
+                if (other_map._cache.enabled())
+                    _cache.reset(other_map._cache.capacity());
+            }
+            catch (...)
+            {
+                _tree.clear(&_root_child->parent);
+                _tree.delete_node(_root_child);
+                throw;
+            }
         }
 
         map     &operator=(const map &other_map)
@@ -74,7 +116,13 @@ namespace ft
                 _allocator = other_map._allocator;
                 _key_compare = other_map._key_compare;
                 _value_compare = other_map._value_compare;
-                insert(other_map.begin(), other_map.end());
+                _root_child->parent = _tree.clone(other_map._root_child->parent, 0);
+                _size = other_map._size;
+                _bloom = other_map._bloom;
+                if (other_map._cache.enabled())
+                    _cache.reset(other_map._cache.capacity());
+                else
+                    _cache.release();
             }
             return *this;
         }
@@ -137,7 +185,15 @@ namespace ft
 
         mapped_type &operator[](const key_type &key)
         {
-            _size += _tree.insert(&_root_child->parent,_tree.create_node(bind_pair(key)));
+            if (_cache.enabled())
+            {
+                node_pointer    node = lookup(key);
+
+                if (node)
+                    return node->value.second;
+            }
+            if (_tree.insert(&_root_child->parent,_tree.create_node(bind_pair(key))))
+                inserted(key);
             node_pointer  p = _tree.find_node(_root_child->parent, bind_pair(key));
             return p->value.second;
         }
@@ -145,13 +201,15 @@ namespace ft
         ft::pair<iterator, bool>    insert(const value_type &value)
         {
             bool    result = _tree.insert(&_root_child->parent, _tree.create_node(value));
-            _size += result;
+            if (result)
+                inserted(value.first);
             return ft::pair<iterator, bool>(iterator(_root_child, _tree.find_node(_root_child->parent, value)), result);
         }
 
         iterator  insert(iterator, const value_type &value)
         {
-            _size += _tree.insert(&_root_child->parent, _tree.create_node(value));
+            if (_tree.insert(&_root_child->parent, _tree.create_node(value)))
+                inserted(value.first);
             return iterator(_root_child, _tree.find_node(_root_child->parent, value));
         }
 
@@ -165,13 +223,17 @@ namespace ft
 
         void    erase(iterator position)
         {
-            _size -= _tree.erase(&_root_child->parent, *position);
+            forget((*position).first);
+            if (_tree.erase(&_root_child->parent, *position))
+                erased();
         }
 
         size_type   erase(const key_type &key)
         {
+            forget(key);
             bool result = _tree.erase(&_root_child->parent, bind_pair(key));
-            _size -= result;
+            if (result)
+                erased();
             return result;
         }
 
@@ -189,6 +251,8 @@ namespace ft
             ft::swap(other_map._key_compare, _key_compare);
             ft::swap(other_map._value_compare, _value_compare);
             ft::swap(other_map._size, _size);
+            _bloom.swap(other_map._bloom);
+            _cache.swap(other_map._cache);
         }
 
         void    clear()
@@ -196,6 +260,21 @@ namespace ft
             _tree.clear(&_root_child->parent);
             _root_child->parent = nullptr;
             _size = 0;
+            _bloom.clear();
+            _cache.clear();
+        }
+
+        void    clear(const execution::sequenced_policy &)
+        {
+            clear();
+        }
+
+        void    clear(const execution::parallel_policy &policy)
+        {
+            _tree.parallel_clear(&policy.executor(), &_root_child->parent);
+            _size = 0;
+            _bloom.clear();
+            _cache.clear();
         }
 
         key_compare     key_comp() const
@@ -210,23 +289,35 @@ namespace ft
 
         iterator        find(const key_type &key)
         {
-            return iterator(_root_child, _tree.find_node(_root_child->parent, bind_pair(key)));
+            return iterator(_root_child, lookup(key));
         }
 
         const_iterator  find(const key_type &key) const
         {
-            return const_iterator(_root_child, _tree.find_node(_root_child->parent, bind_pair(key)));
+            return const_iterator(_root_child, lookup(key));
+        }
+
+        template <class InputIt, class OutputIt>
+        OutputIt        find_batch(InputIt first, InputIt last, OutputIt out)
+        {
+            return find_batch_into<iterator>(first, last, out);
+        }
+
+        template <class InputIt, class OutputIt>
+        OutputIt        find_batch(InputIt first, InputIt last, OutputIt out) const
+        {
+            return find_batch_into<const_iterator>(first, last, out);
         }
 
         size_type       count(const key_type &key) const
         {
-            return _tree.find_node(_root_child->parent, bind_pair(key)) ? 1 : 0;
+            return lookup(key) ? 1 : 0;
         }
 
         mapped_type         &at(const key_type& key)
         {
             iterator    it = find(key);
-            if ((*it).second)
+            if (it != end())
                 return (*it).second;
             throw std::out_of_range("ERROR: container does not have an element with the specified key");
         }
@@ -234,7 +325,7 @@ namespace ft
         const mapped_type   &at(const key_type& key) const
         {
             const_iterator    it = find(key);
-            if ((*it).second)
+            if (it != end())
                 return (*it).second;
             throw std::out_of_range("ERROR: container does not have an element with the specified key");
         }
@@ -282,6 +373,225 @@ namespace ft
             return _allocator;
         }
 
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, _size * sizeof(value_type),
+                                    sizeof(*this) + (_size + 1) * sizeof(ft::node<value_type>) + _bloom.memory()
+                                    + _cache.memory());
+        }
+
+        void    enable_bloom_filter(double bits_per_key = 10)
+        {
+            static_assert(ft::bloom_hash<key_type>::enabled, "bloom filters require integral or std::string keys");
+            static_assert(std::is_same<key_compare, ft::less<key_type> >::value,
+                          "bloom filters require the default ft::less comparator");
+            rebuild_bloom_filter(bits_per_key);
+        }
+
+        void    disable_bloom_filter()
+        {
+            _bloom.release();
+        }
+
+        bool    bloom_filter_enabled() const
+        {
+            return _bloom.enabled();
+        }
+
+        void    rebuild_bloom_filter(double bits_per_key)
+        {
+            _bloom.reset(_size * 2 > 1024 ? _size * 2 : 1024, bits_per_key);
+            for (const_iterator it = begin(); it != end(); ++it)
+                _bloom.insert(ft::bloom_hash<key_type>::hash((*it).first));
+        }
+
+        // Const lookups fill the cache with relaxed atomic stores, so concurrent readers stay safe; erase,
+        // clear and every other mutation still require exclusive access, as without the cache.
+        void    enable_lookup_cache(size_t entries = 4096)
+        {
+            static_assert(ft::bloom_hash<key_type>::enabled, "lookup caches require integral or std::string keys");
+            static_assert(std::is_same<key_compare, ft::less<key_type> >::value,
+                          "lookup caches require the default ft::less comparator");
+            _cache.reset(entries);
+        }
+
+        void    disable_lookup_cache()
+        {
+            _cache.release();
+        }
+
+        bool    lookup_cache_enabled() const
+        {
+            return _cache.enabled();
+        }
+
+        tree_counters   counters() const
+        {
+            return _tree.counters();
+        }
+
+        void    reset_counters()
+        {
+            _tree.reset_counters();
+        }
+
+        tree_diagnostics    diagnostics() const
+        {
+            return _tree.diagnostics(_root_child->parent);
+        }
+
+        void    save(const char *path) const
+        {
+            static_assert(std::is_trivially_copyable<key_type>::value && std::is_trivially_copyable<mapped_type>::value,
+                          "map images require trivially copyable keys and values");
+            write_image(path, begin(), end(), _size, sizeof(value_type), sizeof(key_type), sizeof(mapped_type));
+        }
+
+        template <class Function>
+        void    for_each(const execution::sequenced_policy &, Function function)
+        {
+            for_each_in(0, 0, 0, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::parallel_policy &policy, Function function)
+        {
+            for_each_in(&policy.executor(), 0, 0, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::sequenced_policy &, const key_type &first, const key_type &last,
+                         Function function)
+        {
+            value_type  lower = bind_pair(first);
+            value_type  upper = bind_pair(last);
+
+            for_each_in(0, &lower, &upper, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::parallel_policy &policy, const key_type &first, const key_type &last,
+                         Function function)
+        {
+            value_type  lower = bind_pair(first);
+            value_type  upper = bind_pair(last);
+
+            for_each_in(&policy.executor(), &lower, &upper, function);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::sequenced_policy &, U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(0, 0, 0, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::parallel_policy &policy, U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(&policy.executor(), 0, 0, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::sequenced_policy &, const key_type &first, const key_type &last,
+                       U init, Operation operation, Transform transform) const
+        {
+            value_type  lower = bind_pair(first);
+            value_type  upper = bind_pair(last);
+
+            return reduce_in(0, &lower, &upper, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::parallel_policy &policy, const key_type &first, const key_type &last,
+                       U init, Operation operation, Transform transform) const
+        {
+            value_type  lower = bind_pair(first);
+            value_type  upper = bind_pair(last);
+
+            return reduce_in(&policy.executor(), &lower, &upper, init, operation, transform);
+        }
+
+        class cursor
+        {
+        public:
+            explicit    cursor(map &owner) : _owner(&owner)
+            {
+                reset();
+            }
+
+            void    reset()
+            {
+                _finger = 0;
+                _rightmost = _owner->_tree.max_node(_owner->_root_child->parent);
+            }
+
+            iterator    position() const
+            {
+                return iterator(_owner->_root_child, _finger);
+            }
+
+            iterator    find(const key_type &key)
+            {
+                const value_type    &value = _owner->bind_pair(key);
+                node_pointer        node = 0;
+
+                if (!_rightmost || !_owner->_value_compare(_rightmost->value, value))
+                    node = _owner->_tree.find_node(start(value), value);
+                if (node)
+                    _finger = node;
+                return iterator(_owner->_root_child, node);
+            }
+
+            ft::pair<iterator, bool>    insert(const value_type &value)
+            {
+                node_pointer    node = _owner->_tree.create_node(value);
+                bool            past_end = !_rightmost || _owner->_value_compare(_rightmost->value, value);
+                bool            result;
+
+                result = _owner->_tree.insert_from(&_owner->_root_child->parent, start(value), node);
+                if (result)
+                    _owner->inserted(value.first);
+                if (result && past_end)
+                    _rightmost = node;
+                _finger = node;
+                return ft::pair<iterator, bool>(iterator(_owner->_root_child, node), result);
+            }
+
+            size_type   erase(const key_type &key)
+            {
+                const value_type    &value = _owner->bind_pair(key);
+                node_pointer        node = 0;
+
+                if (!_rightmost || !_owner->_value_compare(_rightmost->value, value))
+                    node = _owner->_tree.find_node(start(value), value);
+                if (!node)
+                    return 0;
+                _finger = _owner->_tree.next_node(node);
+                if (node == _rightmost)
+                    _rightmost = _owner->_tree.prev_node(node);
+                if (!_finger)
+                    _finger = _rightmost;
+                _owner->forget(key);
+                _owner->_tree.erase_node(&_owner->_root_child->parent, node);
+                _owner->erased();
+                return 1;
+            }
+
+        private:
+            map             *_owner;
+            node_pointer    _finger;
+            node_pointer    _rightmost;
+
+            node_pointer    start(const value_type &value) const
+            {
+                if (_rightmost && _owner->_value_compare(_rightmost->value, value))
+                    return _rightmost;
+                if (_finger)
+                    return _owner->_tree.finger_start(_finger, value);
+                return _owner->_root_child->parent;
+            }
+        };
+
     private:
         size_type 			_size;
         allocator_type 		_allocator;
@@ -289,6 +599,57 @@ namespace ft
         value_compare 		_value_compare;
         tree_type 			_tree;
         node_pointer 		_root_child;
+        bloom_filter        _bloom;
+        lookup_cache<ft::node<value_type> > _cache;
+
+        void    inserted(const key_type &key)
+        {
+            ++_size;
+            if (!_bloom.enabled())
+                return;
+            if (_bloom.full())
+                rebuild_bloom_filter(_bloom.bits_per_key());
+            else
+                _bloom.insert(ft::bloom_hash<key_type>::hash(key));
+        }
+
+        void    erased()
+        {
+            --_size;
+            if (_bloom.enabled())
+            {
+                _bloom.erased();
+                if (_bloom.stale(_size))
+                    rebuild_bloom_filter(_bloom.bits_per_key());
+            }
+        }
+
+        void    forget(const key_type &key)
+        {
+            if (_cache.enabled())
+                _cache.invalidate(ft::bloom_hash<key_type>::hash(key));
+        }
+
+        node_pointer    lookup(const key_type &key) const
+        {
+            uint64_t        hash = 0;
+            node_pointer    node;
+
+            if (_cache.enabled() || _bloom.enabled())
+                hash = ft::bloom_hash<key_type>::hash(key);
+            if (_cache.enabled())
+            {
+                node = _cache.find(hash);
+                if (node && !_key_compare(node->value.first, key) && !_key_compare(key, node->value.first))
+                    return node;
+            }
+            if (_bloom.enabled() && !_bloom.may_contain(hash))
+                return nullptr;
+            node = _tree.find_node(_root_child->parent, bind_pair(key));
+            if (node && _cache.enabled())
+                _cache.store(hash, node);
+            return node;
+        }
 
 
         value_type  bind_pair(const Key &key)
@@ -300,6 +661,67 @@ namespace ft
         {
             return ft::make_pair(key, mapped_type());
         }
+
+        template <class U, class Operation, class Transform>
+        struct reducer
+        {
+            U           value;
+            bool        used;
+            Operation   operation;
+            Transform   transform;
+
+            void    operator()(const value_type &element)
+            {
+                if (used)
+                    value = operation(value, transform(element));
+                else
+                {
+                    value = transform(element);
+                    used = true;
+                }
+            }
+        };
+
+        template <class Function>
+        void    for_each_in(thread_pool *pool, const value_type *lower, const value_type *upper, Function function)
+        {
+            ft::vector<Function>    visitors(1, function);
+
+            _tree.parallel_visit(pool, _root_child->parent, lower, upper, visitors);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce_in(thread_pool *pool, const value_type *lower, const value_type *upper,
+                          U init, Operation operation, Transform transform) const
+        {
+            reducer<U, Operation, Transform>            prototype = {init, false, operation, transform};
+            ft::vector<reducer<U, Operation, Transform> > parts(1, prototype);
+
+            _tree.parallel_visit(pool, _root_child->parent, lower, upper, parts);
+            for (size_t i = 0; i < parts.size(); ++i)
+                if (parts[i].used)
+                    init = operation(init, parts[i].value);
+            return init;
+        }
+
+        template <class Iter, class InputIt, class OutputIt>
+        OutputIt    find_batch_into(InputIt first, InputIt last, OutputIt out) const
+        {
+            ft::vector<value_type>  keys;
+            node_pointer            found[tree_type::batch_width];
+
+            keys.reserve(tree_type::batch_width);
+            while (first != last)
+            {
+                keys.clear();
+                for (; first != last && keys.size() < tree_type::batch_width; ++first)
+                    keys.push_back(bind_pair(*first));
+                _tree.find_batch(_root_child->parent, &keys[0], keys.size(), found);
+                for (size_t i = 0; i < keys.size(); ++i)
+                    *out++ = Iter(_root_child, found[i]);
+            }
+            return out;
+        }
     };
 
     template <class Key, class T, class Compare, class Allocator>
@@ -0,0 +1,594 @@
+#ifndef RADIX_MAP_HPP
+#define RADIX_MAP_HPP
+
+#include <stdexcept>
+#include <string>
+#include "../RadixTree/radix_node.hpp"
+#include "../iterator/radix_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+#include "../utilities/radix_key.hpp"
+
+namespace ft
+{
+    template <class Key, class T, class Traits = ft::radix_key<Key> >
+    class radix_map
+    {
+    public:
+        typedef Key                                         key_type;
+        typedef T                                           mapped_type;
+        typedef ft::pair<const Key, T>                      value_type;
+        typedef size_t                                      size_type;
+        typedef std::ptrdiff_t                              difference_type;
+        typedef value_type                                  &reference;
+        typedef const value_type                            &const_reference;
+        typedef ft::radix_iterator<value_type>              iterator;
+        typedef ft::radix_iterator<const value_type>        const_iterator;
+        typedef ft::reverse_iterator<iterator>              reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+        radix_map() : _root(0), _size(0) {}
+
+        template <class InputIterator>
+        radix_map(InputIterator first, InputIterator last) : _root(0), _size(0)
+        {
+            insert(first, last);
+        }
+
+        radix_map(const radix_map &other) : _root(0), _size(0)
+        {
+            insert(other.begin(), other.end());
+        }
+
+        ~radix_map()
+        {
+            clear();
+        }
+
+        radix_map   &operator=(const radix_map &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                insert(other.begin(), other.end());
+            }
+            return *this;
+        }
+
+        iterator                begin()
+        {
+            return iterator(_header.next);
+        }
+
+        const_iterator          begin() const
+        {
+            return const_iterator(_header.next);
+        }
+
+        iterator                end()
+        {
+            return iterator(&_header);
+        }
+
+        const_iterator          end() const
+        {
+            return const_iterator(const_cast<radix_link *>(&_header));
+        }
+
+        reverse_iterator        rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator        rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        ft::pair<iterator, bool>    insert(const value_type &value)
+        {
+            std::string                 bytes;
+            ft::pair<leaf_type *, bool> result;
+
+            Traits::encode(value.first, bytes);
+            result = insert(_root, bytes, 0, value);
+            return ft::make_pair(iterator(result.first), result.second);
+        }
+
+        iterator    insert(iterator, const value_type &value)
+        {
+            return insert(value).first;
+        }
+
+        template <class InputIterator>
+        void        insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        mapped_type &operator[](const key_type &key)
+        {
+            return insert(ft::make_pair(key, mapped_type())).first->second;
+        }
+
+        mapped_type &at(const key_type &key)
+        {
+            iterator    it = find(key);
+
+            if (it == end())
+                throw std::out_of_range("ERROR: container does not have an element with the specified key");
+            return it->second;
+        }
+
+        const mapped_type   &at(const key_type &key) const
+        {
+            const_iterator  it = find(key);
+
+            if (it == end())
+                throw std::out_of_range("ERROR: container does not have an element with the specified key");
+            return it->second;
+        }
+
+        size_type   erase(const key_type &key)
+        {
+            std::string bytes;
+
+            Traits::encode(key, bytes);
+            return erase(_root, bytes, 0);
+        }
+
+        void        erase(iterator position)
+        {
+            erase(position->first);
+        }
+
+        void        erase(iterator first, iterator last)
+        {
+            while (first != last)
+                erase(first++);
+        }
+
+        void        clear()
+        {
+            radix_link  *link = _header.next;
+
+            if (_root && !radix::is_leaf(_root))
+                destroy(static_cast<radix::node *>(_root));
+            while (link != &_header)
+            {
+                radix_link  *next = link->next;
+
+                delete static_cast<leaf_type *>(link);
+                link = next;
+            }
+            _header.prev = &_header;
+            _header.next = &_header;
+            _root = 0;
+            _size = 0;
+        }
+
+        void        swap(radix_map &other)
+        {
+            radix_map   tmp;
+
+            tmp.adopt(*this);
+            adopt(other);
+            other.adopt(tmp);
+        }
+
+        iterator        find(const key_type &key)
+        {
+            return iterator(find_leaf(key));
+        }
+
+        const_iterator  find(const key_type &key) const
+        {
+            return const_iterator(find_leaf(key));
+        }
+
+        size_type       count(const key_type &key) const
+        {
+            return find_leaf(key) != &_header;
+        }
+
+        iterator        lower_bound(const key_type &key)
+        {
+            return iterator(lower_leaf(key));
+        }
+
+        const_iterator  lower_bound(const key_type &key) const
+        {
+            return const_iterator(lower_leaf(key));
+        }
+
+        iterator        upper_bound(const key_type &key)
+        {
+            return iterator(upper_leaf(key));
+        }
+
+        const_iterator  upper_bound(const key_type &key) const
+        {
+            return const_iterator(upper_leaf(key));
+        }
+
+        ft::pair<iterator, iterator>    equal_range(const key_type &key)
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        ft::pair<const_iterator, const_iterator>    equal_range(const key_type &key) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            size_t      leaves = 0;
+            size_t      nodes = _root && !radix::is_leaf(_root) ? footprint(static_cast<radix::node *>(_root)) : 0;
+
+            for (radix_link *link = _header.next; link != &_header; link = link->next)
+            {
+                const std::string   &bytes = static_cast<leaf_type *>(link)->key;
+                const char          *data = bytes.data();
+
+                leaves += sizeof(leaf_type);
+                if (data < (const char *)&bytes || data >= (const char *)(&bytes + 1))
+                    leaves += bytes.capacity() + 1;
+            }
+            return memory_footprint(_size, _size * sizeof(value_type), sizeof(*this) + leaves + nodes);
+        }
+
+    private:
+        typedef radix_leaf<value_type>  leaf_type;
+
+        void        *_root;
+        radix_link  _header;
+        size_type   _size;
+
+        void    adopt(radix_map &other)
+        {
+            _root = other._root;
+            _size = other._size;
+            if (other._header.next == &other._header)
+                _header.prev = _header.next = &_header;
+            else
+            {
+                _header.next = other._header.next;
+                _header.prev = other._header.prev;
+                _header.next->prev = &_header;
+                _header.prev->next = &_header;
+            }
+            other._root = 0;
+            other._size = 0;
+            other._header.prev = other._header.next = &other._header;
+        }
+
+        static leaf_type    *leaf(const void *child)
+        {
+            return static_cast<leaf_type *>(radix::untag_leaf(child));
+        }
+
+        static leaf_type    *minimum_leaf(const void *child)
+        {
+            while (!radix::is_leaf(child))
+                child = radix::next_child(static_cast<const radix::node *>(child), -1);
+            return leaf(child);
+        }
+
+        static leaf_type    *maximum_leaf(const void *child)
+        {
+            while (!radix::is_leaf(child))
+                child = radix::previous_child(static_cast<const radix::node *>(child), 256);
+            return leaf(child);
+        }
+
+        static void set_prefix(radix::node *n, const std::string &bytes, size_t from, size_t length)
+        {
+            n->prefix_length = (uint32_t)length;
+            for (size_t i = 0; i < length && i < radix::max_prefix; ++i)
+                n->prefix[i] = (unsigned char)bytes[from + i];
+        }
+
+        static size_t   prefix_mismatch(const radix::node *n, const std::string &bytes, size_t depth)
+        {
+            size_t  i = 0;
+
+            for (; i < n->prefix_length && i < radix::max_prefix; ++i)
+                if (depth + i >= bytes.size() || n->prefix[i] != (unsigned char)bytes[depth + i])
+                    return i;
+            if (n->prefix_length > radix::max_prefix)
+            {
+                const std::string   &full = minimum_leaf(n)->key;
+
+                for (; i < n->prefix_length; ++i)
+                    if (depth + i >= bytes.size() || full[depth + i] != bytes[depth + i])
+                        return i;
+            }
+            return n->prefix_length;
+        }
+
+        leaf_type   *create(const std::string &bytes, const value_type &value, radix_link *successor)
+        {
+            leaf_type   *created = new leaf_type(value, bytes);
+
+            created->next = successor;
+            created->prev = successor->prev;
+            successor->prev->next = created;
+            successor->prev = created;
+            ++_size;
+            return created;
+        }
+
+        void    destroy(leaf_type *removed)
+        {
+            removed->prev->next = removed->next;
+            removed->next->prev = removed->prev;
+            delete removed;
+            --_size;
+        }
+
+        void    destroy(radix::node *n)
+        {
+            void        *children[256];
+            unsigned    count = radix::collect_children(n, children);
+
+            for (unsigned i = 0; i < count; ++i)
+                if (!radix::is_leaf(children[i]))
+                    destroy(static_cast<radix::node *>(children[i]));
+            radix::delete_node(n);
+        }
+
+        size_t  footprint(const radix::node *n) const
+        {
+            void        *children[256];
+            unsigned    count = radix::collect_children(n, children);
+            size_t      total = radix::node_size(n);
+
+            for (unsigned i = 0; i < count; ++i)
+                if (!radix::is_leaf(children[i]))
+                    total += footprint(static_cast<radix::node *>(children[i]));
+            return total;
+        }
+
+        ft::pair<leaf_type *, bool> insert(void *&ref, const std::string &bytes, size_t depth, const value_type &value)
+        {
+            if (!ref)
+            {
+                leaf_type   *created = create(bytes, value, &_header);
+
+                ref = radix::tag_leaf(created);
+                return ft::make_pair(created, true);
+            }
+            if (radix::is_leaf(ref))
+            {
+                leaf_type   *existing = leaf(ref);
+                size_t      split = depth;
+
+                if (existing->key == bytes)
+                    return ft::make_pair(existing, false);
+                while (existing->key[split] == bytes[split])
+                    ++split;
+
+                radix::node *parent = new radix::node_4;
+                bool        before = (unsigned char)bytes[split] < (unsigned char)existing->key[split];
+                leaf_type   *created = create(bytes, value, before ? existing : existing->next);
+
+                set_prefix(parent, bytes, depth, split - depth);
+                radix::add_child(parent, (unsigned char)existing->key[split], ref);
+                radix::add_child(parent, (unsigned char)bytes[split], radix::tag_leaf(created));
+                ref = parent;
+                return ft::make_pair(created, true);
+            }
+
+            radix::node *n = static_cast<radix::node *>(ref);
+
+            if (n->prefix_length)
+            {
+                size_t  match = prefix_mismatch(n, bytes, depth);
+
+                if (match < n->prefix_length)
+                {
+                    const std::string   &full = minimum_leaf(n)->key;
+                    unsigned char       old_byte = (unsigned char)full[depth + match];
+                    radix::node         *parent = new radix::node_4;
+                    bool                before = (unsigned char)bytes[depth + match] < old_byte;
+                    leaf_type           *created = create(bytes, value, before ? minimum_leaf(n) : maximum_leaf(n)->next);
+
+                    set_prefix(parent, bytes, depth, match);
+                    set_prefix(n, full, depth + match + 1, n->prefix_length - match - 1);
+                    radix::add_child(parent, old_byte, n);
+                    radix::add_child(parent, (unsigned char)bytes[depth + match], radix::tag_leaf(created));
+                    ref = parent;
+                    return ft::make_pair(created, true);
+                }
+                depth += n->prefix_length;
+            }
+
+            unsigned char   byte = (unsigned char)bytes[depth];
+            void            **child = radix::find_child(n, byte);
+
+            if (child)
+                return insert(*child, bytes, depth + 1, value);
+
+            void        *next = radix::next_child(n, byte);
+            leaf_type   *created = create(bytes, value, next ? minimum_leaf(next) : maximum_leaf(n)->next);
+            radix::node *&node_ref = reinterpret_cast<radix::node *&>(ref);
+
+            radix::add_child(node_ref, byte, radix::tag_leaf(created));
+            return ft::make_pair(created, true);
+        }
+
+        size_type   erase(void *&ref, const std::string &bytes, size_t depth)
+        {
+            if (!ref)
+                return 0;
+            if (radix::is_leaf(ref))
+            {
+                if (leaf(ref)->key != bytes)
+                    return 0;
+                destroy(leaf(ref));
+                ref = 0;
+                return 1;
+            }
+
+            radix::node     *n = static_cast<radix::node *>(ref);
+            size_t          start = depth;
+
+            if (prefix_mismatch(n, bytes, depth) != n->prefix_length)
+                return 0;
+            depth += n->prefix_length;
+            if (depth >= bytes.size())
+                return 0;
+
+            unsigned char   byte = (unsigned char)bytes[depth];
+            void            **child = radix::find_child(n, byte);
+
+            if (!child)
+                return 0;
+            if (!radix::is_leaf(*child))
+                return erase(*child, bytes, depth + 1);
+            if (leaf(*child)->key != bytes)
+                return 0;
+            destroy(leaf(*child));
+
+            radix::node *&node_ref = reinterpret_cast<radix::node *&>(ref);
+
+            radix::remove_child(node_ref, byte);
+            if (node_ref->kind == radix::node4 && node_ref->count == 1)
+                collapse(ref, start);
+            return 1;
+        }
+
+        void    collapse(void *&ref, size_t depth)
+        {
+            radix::node     *n = static_cast<radix::node *>(ref);
+            void            *only = static_cast<radix::node_4 *>(n)->children[0];
+
+            if (!radix::is_leaf(only))
+            {
+                radix::node *child = static_cast<radix::node *>(only);
+
+                set_prefix(child, minimum_leaf(child)->key, depth, n->prefix_length + 1 + child->prefix_length);
+            }
+            radix::delete_node(n);
+            ref = only;
+        }
+
+        radix_link  *find_leaf(const key_type &key) const
+        {
+            std::string bytes;
+            const void  *child = _root;
+            size_t      depth = 0;
+
+            Traits::encode(key, bytes);
+            while (child && !radix::is_leaf(child))
+            {
+                radix::node *n = static_cast<radix::node *>(const_cast<void *>(child));
+
+                for (size_t i = 0; i < n->prefix_length && i < radix::max_prefix; ++i)
+                    if (depth + i >= bytes.size() || n->prefix[i] != (unsigned char)bytes[depth + i])
+                        return const_cast<radix_link *>(&_header);
+                depth += n->prefix_length;
+                if (depth >= bytes.size())
+                    return const_cast<radix_link *>(&_header);
+
+                void    **slot = radix::find_child(n, (unsigned char)bytes[depth++]);
+
+                child = slot ? *slot : 0;
+            }
+            if (child && leaf(child)->key == bytes)
+                return leaf(child);
+            return const_cast<radix_link *>(&_header);
+        }
+
+        radix_link  *lower_leaf(const key_type &key) const
+        {
+            std::string bytes;
+
+            Traits::encode(key, bytes);
+            if (!_root)
+                return const_cast<radix_link *>(&_header);
+            return lower_leaf(_root, bytes, 0);
+        }
+
+        radix_link  *lower_leaf(const void *child, const std::string &bytes, size_t depth) const
+        {
+            if (radix::is_leaf(child))
+                return leaf(child)->key >= bytes ? leaf(child) : leaf(child)->next;
+
+            const radix::node   *n = static_cast<const radix::node *>(child);
+            size_t              match = prefix_mismatch(n, bytes, depth);
+
+            if (match < n->prefix_length)
+            {
+                if (depth + match >= bytes.size()
+                    || (unsigned char)minimum_leaf(n)->key[depth + match] > (unsigned char)bytes[depth + match])
+                    return minimum_leaf(n);
+                return maximum_leaf(n)->next;
+            }
+            depth += n->prefix_length;
+            if (depth >= bytes.size())
+                return minimum_leaf(n);
+
+            unsigned char   byte = (unsigned char)bytes[depth];
+            void            **slot = radix::find_child(const_cast<radix::node *>(n), byte);
+
+            if (slot)
+                return lower_leaf(*slot, bytes, depth + 1);
+
+            void    *next = radix::next_child(n, byte);
+
+            return next ? minimum_leaf(next) : maximum_leaf(n)->next;
+        }
+
+        radix_link  *upper_leaf(const key_type &key) const
+        {
+            radix_link  *link = lower_leaf(key);
+
+            if (link != &_header)
+            {
+                std::string bytes;
+
+                Traits::encode(key, bytes);
+                if (static_cast<leaf_type *>(link)->key == bytes)
+                    link = link->next;
+            }
+            return link;
+        }
+    };
+
+    template <class Key, class T, class Traits>
+    bool    operator==(const radix_map<Key, T, Traits> &lhs, const radix_map<Key, T, Traits> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Key, class T, class Traits>
+    bool    operator!=(const radix_map<Key, T, Traits> &lhs, const radix_map<Key, T, Traits> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif
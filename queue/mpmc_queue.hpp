@@ -0,0 +1,373 @@
+#ifndef MPMC_QUEUE_HPP
+#define MPMC_QUEUE_HPP
+
+#include <memory>
+#include <sched.h>
+#include "../utilities/atomic.hpp"
+
+namespace ft
+{
+    inline void queue_backoff(unsigned long &spins)
+    {
+        if (++spins < 64)
+            ft::cpu_relax();
+        else
+            sched_yield();
+    }
+
+    inline unsigned long    queue_capacity(unsigned long capacity)
+    {
+        unsigned long   rounded = 2;
+
+        while (rounded < capacity)
+            rounded <<= 1;
+        return rounded;
+    }
+
+    template <class T, class Allocator = std::allocator<T> >
+    class mpmc_queue
+    {
+    public:
+        typedef T                                   value_type;
+        typedef Allocator                           allocator_type;
+        typedef typename allocator_type::size_type  size_type;
+
+        explicit    mpmc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _cell_allocator(alloc), _capacity(ft::queue_capacity(capacity)),
+              _mask(_capacity - 1), _enqueue(0), _dequeue(0)
+        {
+            _cells = _cell_allocator.allocate(_capacity);
+            for (size_type i = 0; i < _capacity; ++i)
+            {
+                _cells[i].sequence = i;
+                _cells[i].skipped = false;
+            }
+        }
+
+        ~mpmc_queue()
+        {
+            for (size_type pos = _dequeue; pos != _enqueue; ++pos)
+                if (_cells[pos & _mask].sequence == pos + 1 && !_cells[pos & _mask].skipped)
+                    _allocator.destroy(&_cells[pos & _mask].value);
+            _cell_allocator.deallocate(_cells, _capacity);
+        }
+
+        bool    try_push(const value_type &value)
+        {
+            size_type   pos;
+
+            if (!claim(&_enqueue, 0, 1, pos))
+                return false;
+            publish(pos, 1, &value);
+            return true;
+        }
+
+        bool    try_pop(value_type &out)
+        {
+            size_type   pos;
+
+            while (claim(&_dequeue, 1, 1, pos))
+                if (release(pos, out))
+                    return true;
+            return false;
+        }
+
+        void    push(const value_type &value)
+        {
+            for (unsigned long spins = 0; !try_push(value); )
+                ft::queue_backoff(spins);
+        }
+
+        void    pop(value_type &out)
+        {
+            for (unsigned long spins = 0; !try_pop(out); )
+                ft::queue_backoff(spins);
+        }
+
+        template <class InputIterator>
+        size_type   try_push_n(InputIterator first, size_type count)
+        {
+            size_type   pos;
+            size_type   claimed = claim(&_enqueue, 0, count, pos);
+
+            publish(pos, claimed, first);
+            return claimed;
+        }
+
+        template <class OutputIterator>
+        size_type   try_pop_n(OutputIterator out, size_type count)
+        {
+            size_type   pos;
+            size_type   claimed = claim(&_dequeue, 1, count, pos);
+            size_type   popped = 0;
+
+            for (size_type i = 0; i < claimed; ++i)
+            {
+                cell    &current = _cells[(pos + i) & _mask];
+
+                if (!current.skipped)
+                {
+                    *out++ = current.value;
+                    _allocator.destroy(&current.value);
+                    ++popped;
+                }
+                current.skipped = false;
+                ft::atomic_store(&current.sequence, pos + i + _mask + 1);
+            }
+            return popped;
+        }
+
+        size_type   size() const
+        {
+            size_type   dequeue = ft::atomic_load(&_dequeue);
+            size_type   enqueue = ft::atomic_load(&_enqueue);
+
+            return enqueue > dequeue ? enqueue - dequeue : 0;
+        }
+
+        bool        empty() const
+        {
+            return !size();
+        }
+
+        size_type   capacity() const
+        {
+            return _capacity;
+        }
+
+        allocator_type  get_allocator() const
+        {
+            return _allocator;
+        }
+
+    private:
+        struct cell
+        {
+            size_type   sequence;
+            bool        skipped;
+            value_type  value;
+        };
+
+        typedef typename Allocator::template rebind<cell>::other    cell_allocator_type;
+
+        allocator_type      _allocator;
+        cell_allocator_type _cell_allocator;
+        cell                *_cells;
+        size_type           _capacity;
+        size_type           _mask;
+        char                _pad0[ft::cache_line_size];
+        size_type           _enqueue;
+        char                _pad1[ft::cache_line_size - sizeof(size_type)];
+        size_type           _dequeue;
+        char                _pad2[ft::cache_line_size - sizeof(size_type)];
+
+        mpmc_queue(const mpmc_queue &);
+        mpmc_queue  &operator=(const mpmc_queue &);
+
+        size_type   claim(size_type *position, size_type ready, size_type count, size_type &pos)
+        {
+            if (count > _capacity)
+                count = _capacity;
+            pos = ft::atomic_load_relaxed(position);
+            for (;;)
+            {
+                size_type   available = 0;
+
+                while (available < count)
+                {
+                    size_type   sequence = ft::atomic_load(&_cells[(pos + available) & _mask].sequence);
+
+                    if (sequence != pos + available + ready)
+                        break;
+                    ++available;
+                }
+                if (!available)
+                {
+                    size_type       sequence = ft::atomic_load(&_cells[pos & _mask].sequence);
+                    std::ptrdiff_t  diff = (std::ptrdiff_t)(sequence - (pos + ready));
+
+                    if (diff < 0)
+                        return 0;
+                    pos = ft::atomic_load_relaxed(position);
+                    continue;
+                }
+                if (ft::atomic_compare_exchange(position, pos, pos + available))
+                    return available;
+            }
+        }
+
+        template <class InputIterator>
+        void    publish(size_type pos, size_type count, InputIterator first)
+        {
+            size_type   i = 0;
+
+            try
+            {
+                for (; i < count; ++i, ++first)
+                    _allocator.construct(&_cells[(pos + i) & _mask].value, *first);
+            }
+            catch (...)
+            {
+                while (i--)
+                    _allocator.destroy(&_cells[(pos + i) & _mask].value);
+                for (i = 0; i < count; ++i)
+                {
+                    _cells[(pos + i) & _mask].skipped = true;
+                    ft::atomic_store(&_cells[(pos + i) & _mask].sequence, pos + i + 1);
+                }
+                throw;
+            }
+            for (i = 0; i < count; ++i)
+                ft::atomic_store(&_cells[(pos + i) & _mask].sequence, pos + i + 1);
+        }
+
+        bool    release(size_type pos, value_type &out)
+        {
+            cell    &current = _cells[pos & _mask];
+            bool    filled = !current.skipped;
+
+            if (filled)
+            {
+                out = current.value;
+                _allocator.destroy(&current.value);
+            }
+            current.skipped = false;
+            ft::atomic_store(&current.sequence, pos + _mask + 1);
+            return filled;
+        }
+    };
+
+    template <class T, class Allocator = std::allocator<T> >
+    class spsc_queue
+    {
+    public:
+        typedef T                                   value_type;
+        typedef Allocator                           allocator_type;
+        typedef typename allocator_type::size_type  size_type;
+
+        explicit    spsc_queue(size_type capacity, const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _capacity(ft::queue_capacity(capacity)), _mask(_capacity - 1),
+              _tail(0), _cached_head(0), _head(0), _cached_tail(0)
+        {
+            _buffer = _allocator.allocate(_capacity);
+        }
+
+        ~spsc_queue()
+        {
+            for (size_type pos = _head; pos != _tail; ++pos)
+                _allocator.destroy(&_buffer[pos & _mask]);
+            _allocator.deallocate(_buffer, _capacity);
+        }
+
+        bool    try_push(const value_type &value)
+        {
+            return try_push_n(&value, 1) == 1;
+        }
+
+        bool    try_pop(value_type &out)
+        {
+            return try_pop_n(&out, 1) == 1;
+        }
+
+        void    push(const value_type &value)
+        {
+            for (unsigned long spins = 0; !try_push(value); )
+                ft::queue_backoff(spins);
+        }
+
+        void    pop(value_type &out)
+        {
+            for (unsigned long spins = 0; !try_pop(out); )
+                ft::queue_backoff(spins);
+        }
+
+        template <class InputIterator>
+        size_type   try_push_n(InputIterator first, size_type count)
+        {
+            size_type   tail = ft::atomic_load_relaxed(&_tail);
+
+            if (tail + count - _cached_head > _capacity)
+                _cached_head = ft::atomic_load(&_head);
+
+            size_type   room = _capacity - (tail - _cached_head);
+
+            if (count > room)
+                count = room;
+
+            size_type   i = 0;
+
+            try
+            {
+                for (; i < count; ++i, ++first)
+                    _allocator.construct(&_buffer[(tail + i) & _mask], *first);
+            }
+            catch (...)
+            {
+                while (i--)
+                    _allocator.destroy(&_buffer[(tail + i) & _mask]);
+                throw;
+            }
+            ft::atomic_store(&_tail, tail + count);
+            return count;
+        }
+
+        template <class OutputIterator>
+        size_type   try_pop_n(OutputIterator out, size_type count)
+        {
+            size_type   head = ft::atomic_load_relaxed(&_head);
+
+            if (_cached_tail - head < count)
+                _cached_tail = ft::atomic_load(&_tail);
+
+            size_type   ready = _cached_tail - head;
+
+            if (count > ready)
+                count = ready;
+            for (size_type i = 0; i < count; ++i)
+            {
+                *out++ = _buffer[(head + i) & _mask];
+                _allocator.destroy(&_buffer[(head + i) & _mask]);
+            }
+            ft::atomic_store(&_head, head + count);
+            return count;
+        }
+
+        size_type   size() const
+        {
+            return ft::atomic_load(&_tail) - ft::atomic_load(&_head);
+        }
+
+        bool        empty() const
+        {
+            return !size();
+        }
+
+        size_type   capacity() const
+        {
+            return _capacity;
+        }
+
+        allocator_type  get_allocator() const
+        {
+            return _allocator;
+        }
+
+    private:
+        allocator_type      _allocator;
+        value_type          *_buffer;
+        size_type           _capacity;
+        size_type           _mask;
+        char                _pad0[ft::cache_line_size];
+        size_type           _tail;
+        size_type           _cached_head;
+        char                _pad1[ft::cache_line_size - 2 * sizeof(size_type)];
+        size_type           _head;
+        size_type           _cached_tail;
+        char                _pad2[ft::cache_line_size - 2 * sizeof(size_type)];
+
+        spsc_queue(const spsc_queue &);
+        spsc_queue  &operator=(const spsc_queue &);
+    };
+}
+
+#endif
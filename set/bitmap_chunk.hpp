@@ -0,0 +1,555 @@
+#ifndef BITMAP_CHUNK_HPP
+#define BITMAP_CHUNK_HPP
+
+#include <stdint.h>
+#include "../vector/vector.hpp"
+#include "../utilities/bit_words.hpp"
+#include "../utilities/bit_packing.hpp"
+
+namespace ft
+{
+    struct bitmap_chunk
+    {
+        enum kind_type { array, bitmap, run };
+
+        enum { span = 65536, array_limit = 4096, bitmap_words = span / bits::word_bits };
+
+        uint64_t                key;
+        kind_type               kind;
+        uint32_t                cardinality;
+        ft::vector<uint16_t>    values;
+        ft::vector<uint64_t>    words;
+
+        explicit bitmap_chunk(uint64_t chunk_key = 0) : key(chunk_key), kind(array), cardinality(0) {}
+
+        size_t  runs() const
+        {
+            return values.size() / 2;
+        }
+
+        uint32_t    run_start(size_t run) const
+        {
+            return values[run * 2];
+        }
+
+        uint32_t    run_last(size_t run) const
+        {
+            return values[run * 2 + 1];
+        }
+
+        size_t  lower_index(uint32_t low) const
+        {
+            size_t  first = 0;
+            size_t  count = values.size();
+
+            while (count)
+            {
+                size_t  half = count / 2;
+
+                if (values[first + half] < low)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                    count = half;
+            }
+            return first;
+        }
+
+        size_t  run_index(uint32_t low) const
+        {
+            size_t  first = 0;
+            size_t  count = runs();
+
+            while (count)
+            {
+                size_t  half = count / 2;
+
+                if (run_last(first + half) < low)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                    count = half;
+            }
+            return first;
+        }
+
+        bool    test(uint32_t low) const
+        {
+            return (words[low / bits::word_bits] >> (low % bits::word_bits)) & 1;
+        }
+
+        bool    contains(uint32_t low) const
+        {
+            if (kind == array)
+            {
+                size_t  index = lower_index(low);
+
+                return index < values.size() && values[index] == low;
+            }
+            if (kind == bitmap)
+                return test(low);
+
+            size_t  index = run_index(low);
+
+            return index < runs() && run_start(index) <= low;
+        }
+
+        bool    add(uint32_t low)
+        {
+            if (kind == run)
+            {
+                if (contains(low))
+                    return false;
+                expand();
+            }
+            if (kind == array)
+            {
+                size_t  index = lower_index(low);
+
+                if (index < values.size() && values[index] == low)
+                    return false;
+                values.insert(values.begin() + index, (uint16_t)low);
+                if (++cardinality > array_limit)
+                    to_bitmap();
+                return true;
+            }
+            if (test(low))
+                return false;
+            words[low / bits::word_bits] |= (uint64_t)1 << (low % bits::word_bits);
+            ++cardinality;
+            return true;
+        }
+
+        bool    remove(uint32_t low)
+        {
+            if (!contains(low))
+                return false;
+            if (kind == run)
+                expand();
+            if (kind == array)
+                values.erase(values.begin() + lower_index(low));
+            else
+                words[low / bits::word_bits] &= ~((uint64_t)1 << (low % bits::word_bits));
+            --cardinality;
+            normalize();
+            return true;
+        }
+
+        void    to_bitmap()
+        {
+            ft::vector<uint64_t>    dense(bitmap_words, 0);
+
+            if (kind == array)
+                for (size_t i = 0; i < values.size(); ++i)
+                    dense[values[i] / bits::word_bits] |= (uint64_t)1 << (values[i] % bits::word_bits);
+            else if (kind == run)
+                for (size_t r = 0; r < runs(); ++r)
+                    for (uint32_t low = run_start(r); low <= run_last(r); ++low)
+                        dense[low / bits::word_bits] |= (uint64_t)1 << (low % bits::word_bits);
+            ft::vector<uint16_t>().swap(values);
+            words.swap(dense);
+            kind = bitmap;
+        }
+
+        void    to_array()
+        {
+            ft::vector<uint16_t>    sorted;
+            size_t                  slot;
+            uint32_t                low;
+
+            sorted.reserve(cardinality);
+            for (bool more = cardinality && first(slot, low); more; more = next(slot, low))
+                sorted.push_back((uint16_t)low);
+            ft::vector<uint64_t>().swap(words);
+            values.swap(sorted);
+            kind = array;
+        }
+
+        void    to_run()
+        {
+            ft::vector<uint16_t>    pairs;
+            size_t                  slot;
+            uint32_t                low;
+
+            for (bool more = cardinality && first(slot, low); more; more = next(slot, low))
+            {
+                if (!pairs.empty() && pairs.back() + 1u == low)
+                    pairs.back() = (uint16_t)low;
+                else
+                {
+                    pairs.push_back((uint16_t)low);
+                    pairs.push_back((uint16_t)low);
+                }
+            }
+            pairs.shrink_to_fit();
+            ft::vector<uint64_t>().swap(words);
+            values.swap(pairs);
+            kind = run;
+        }
+
+        void    expand()
+        {
+            if (cardinality <= array_limit)
+                to_array();
+            else
+                to_bitmap();
+        }
+
+        void    normalize()
+        {
+            if (kind == bitmap && cardinality <= array_limit)
+                to_array();
+            else if (kind == array && cardinality > array_limit)
+                to_bitmap();
+        }
+
+        size_t  count_runs() const
+        {
+            size_t  count = 0;
+
+            if (kind == run)
+                return runs();
+            if (kind == array)
+            {
+                for (size_t i = 0; i < values.size(); ++i)
+                    if (!i || values[i] != values[i - 1] + 1)
+                        ++count;
+                return count;
+            }
+            for (size_t i = 0; i < bitmap_words; ++i)
+            {
+                uint64_t    carry = i ? words[i - 1] >> (bits::word_bits - 1) : 0;
+
+                count += bits::popcount(words[i] & ~((words[i] << 1) | carry));
+            }
+            return count;
+        }
+
+        void    optimize()
+        {
+            size_t  run_bytes = count_runs() * 2 * sizeof(uint16_t);
+            size_t  plain_bytes = cardinality <= array_limit ? cardinality * sizeof(uint16_t)
+                                                             : bitmap_words * sizeof(uint64_t);
+
+            if (run_bytes < plain_bytes)
+            {
+                if (kind != run)
+                    to_run();
+            }
+            else if (kind == run)
+                expand();
+            else
+                normalize();
+            values.shrink_to_fit();
+        }
+
+        size_t  previous_set(uint32_t from) const
+        {
+            size_t      index = from / bits::word_bits;
+            unsigned    shift = from % bits::word_bits;
+            uint64_t    word = words[index];
+
+            if (shift != bits::word_bits - 1)
+                word &= ((uint64_t)1 << (shift + 1)) - 1;
+            while (!word)
+            {
+                if (!index)
+                    return span;
+                word = words[--index];
+            }
+            return index * bits::word_bits + bits::width_of(word) - 1;
+        }
+
+        bool    first(size_t &slot, uint32_t &low) const
+        {
+            slot = 0;
+            if (kind == array)
+                low = values[0];
+            else if (kind == run)
+                low = run_start(0);
+            else
+                low = (uint32_t)bits::find_set(&words[0], bitmap_words, 0);
+            return true;
+        }
+
+        bool    last(size_t &slot, uint32_t &low) const
+        {
+            if (kind == array)
+                low = values[slot = values.size() - 1];
+            else if (kind == run)
+                low = run_last(slot = runs() - 1);
+            else
+                low = (uint32_t)previous_set(span - 1);
+            return true;
+        }
+
+        bool    next(size_t &slot, uint32_t &low) const
+        {
+            if (kind == array)
+            {
+                if (slot + 1 >= values.size())
+                    return false;
+                low = values[++slot];
+                return true;
+            }
+            if (kind == run)
+            {
+                if (low < run_last(slot))
+                    ++low;
+                else if (slot + 1 < runs())
+                    low = run_start(++slot);
+                else
+                    return false;
+                return true;
+            }
+            if (low + 1 >= span)
+                return false;
+
+            size_t  found = bits::find_set(&words[0], bitmap_words, low + 1);
+
+            if (found >= span)
+                return false;
+            low = (uint32_t)found;
+            return true;
+        }
+
+        bool    prev(size_t &slot, uint32_t &low) const
+        {
+            if (kind == array)
+            {
+                if (!slot)
+                    return false;
+                low = values[--slot];
+                return true;
+            }
+            if (kind == run)
+            {
+                if (low > run_start(slot))
+                    --low;
+                else if (slot)
+                    low = run_last(--slot);
+                else
+                    return false;
+                return true;
+            }
+            if (!low)
+                return false;
+
+            size_t  found = previous_set(low - 1);
+
+            if (found >= span)
+                return false;
+            low = (uint32_t)found;
+            return true;
+        }
+
+        bool    seek(uint32_t from, size_t &slot, uint32_t &low) const
+        {
+            if (kind == array)
+            {
+                slot = lower_index(from);
+                if (slot >= values.size())
+                    return false;
+                low = values[slot];
+                return true;
+            }
+            if (kind == run)
+            {
+                slot = run_index(from);
+                if (slot >= runs())
+                    return false;
+                low = from > run_start(slot) ? from : run_start(slot);
+                return true;
+            }
+
+            size_t  found = bits::find_set(&words[0], bitmap_words, from);
+
+            if (found >= span)
+                return false;
+            slot = 0;
+            low = (uint32_t)found;
+            return true;
+        }
+
+        size_t  rank(uint32_t low) const
+        {
+            size_t  count = 0;
+
+            if (kind == array)
+                return lower_index(low);
+            if (kind == bitmap)
+                return bits::count(&words[0], low / bits::word_bits)
+                       + bits::popcount(words[low / bits::word_bits]
+                                        & (((uint64_t)1 << (low % bits::word_bits)) - 1));
+            for (size_t r = 0; r < runs() && run_start(r) < low; ++r)
+                count += (run_last(r) < low ? run_last(r) : low - 1) - run_start(r) + 1;
+            return count;
+        }
+
+        uint32_t    select(size_t n) const
+        {
+            if (kind == array)
+                return values[n];
+            if (kind == run)
+            {
+                for (size_t r = 0;; ++r)
+                {
+                    size_t  length = run_last(r) - run_start(r) + 1;
+
+                    if (n < length)
+                        return run_start(r) + (uint32_t)n;
+                    n -= length;
+                }
+            }
+            for (size_t i = 0;; ++i)
+            {
+                uint64_t    word = words[i];
+                size_t      count = bits::popcount(word);
+
+                if (n < count)
+                {
+                    while (n--)
+                        word &= word - 1;
+                    return (uint32_t)(i * bits::word_bits + bits::trailing_zeros(word));
+                }
+                n -= count;
+            }
+        }
+
+        size_t  memory() const
+        {
+            return sizeof(*this) + values.capacity() * sizeof(uint16_t) + words.capacity() * sizeof(uint64_t);
+        }
+
+        static void expanded(const bitmap_chunk &lhs, const bitmap_chunk &rhs, bitmap_chunk &out,
+                             void (*operation)(const bitmap_chunk &, const bitmap_chunk &, bitmap_chunk &))
+        {
+            bitmap_chunk    left(lhs);
+            bitmap_chunk    right(rhs);
+
+            if (left.kind == run)
+                left.expand();
+            if (right.kind == run)
+                right.expand();
+            operation(left, right, out);
+        }
+
+        static void unite(const bitmap_chunk &lhs, const bitmap_chunk &rhs, bitmap_chunk &out)
+        {
+            if (lhs.kind == run || rhs.kind == run)
+                return expanded(lhs, rhs, out, &unite);
+            if (lhs.kind == array && rhs.kind == array && lhs.cardinality + rhs.cardinality <= array_limit)
+            {
+                size_t  i = 0;
+                size_t  j = 0;
+
+                out.values.reserve(lhs.cardinality + rhs.cardinality);
+                while (i < lhs.values.size() || j < rhs.values.size())
+                {
+                    if (j == rhs.values.size() || (i < lhs.values.size() && lhs.values[i] < rhs.values[j]))
+                        out.values.push_back(lhs.values[i++]);
+                    else if (i == lhs.values.size() || rhs.values[j] < lhs.values[i])
+                        out.values.push_back(rhs.values[j++]);
+                    else
+                    {
+                        out.values.push_back(lhs.values[i++]);
+                        ++j;
+                    }
+                }
+                out.kind = array;
+                out.cardinality = (uint32_t)out.values.size();
+                return;
+            }
+
+            const bitmap_chunk  &dense = lhs.kind == bitmap ? lhs : rhs;
+            const bitmap_chunk  &other = lhs.kind == bitmap ? rhs : lhs;
+
+            out.kind = dense.kind;
+            out.values = dense.values;
+            out.words = dense.words;
+            if (out.kind == array)
+                out.to_bitmap();
+            if (other.kind == bitmap)
+                bits::or_words(&out.words[0], &other.words[0], bitmap_words);
+            else
+                for (size_t i = 0; i < other.values.size(); ++i)
+                    out.words[other.values[i] / bits::word_bits] |= (uint64_t)1 << (other.values[i] % bits::word_bits);
+            out.cardinality = (uint32_t)bits::count(&out.words[0], bitmap_words);
+            out.normalize();
+        }
+
+        static void intersect(const bitmap_chunk &lhs, const bitmap_chunk &rhs, bitmap_chunk &out)
+        {
+            if (lhs.kind == run || rhs.kind == run)
+                return expanded(lhs, rhs, out, &intersect);
+            out.kind = array;
+            if (lhs.kind == array && rhs.kind == array)
+            {
+                size_t  i = 0;
+                size_t  j = 0;
+
+                while (i < lhs.values.size() && j < rhs.values.size())
+                {
+                    if (lhs.values[i] < rhs.values[j])
+                        ++i;
+                    else if (rhs.values[j] < lhs.values[i])
+                        ++j;
+                    else
+                    {
+                        out.values.push_back(lhs.values[i++]);
+                        ++j;
+                    }
+                }
+            }
+            else if (lhs.kind == array || rhs.kind == array)
+            {
+                const bitmap_chunk  &sparse = lhs.kind == array ? lhs : rhs;
+                const bitmap_chunk  &dense = lhs.kind == array ? rhs : lhs;
+
+                for (size_t i = 0; i < sparse.values.size(); ++i)
+                    if (dense.test(sparse.values[i]))
+                        out.values.push_back(sparse.values[i]);
+            }
+            else
+            {
+                out.words = lhs.words;
+                out.kind = bitmap;
+                bits::and_words(&out.words[0], &rhs.words[0], bitmap_words);
+                out.cardinality = (uint32_t)bits::count(&out.words[0], bitmap_words);
+                out.normalize();
+                return;
+            }
+            out.cardinality = (uint32_t)out.values.size();
+        }
+
+        static void subtract(const bitmap_chunk &lhs, const bitmap_chunk &rhs, bitmap_chunk &out)
+        {
+            if (lhs.kind == run || rhs.kind == run)
+                return expanded(lhs, rhs, out, &subtract);
+            if (lhs.kind == array)
+            {
+                out.kind = array;
+                for (size_t i = 0; i < lhs.values.size(); ++i)
+                    if (!rhs.contains(lhs.values[i]))
+                        out.values.push_back(lhs.values[i]);
+                out.cardinality = (uint32_t)out.values.size();
+                return;
+            }
+            out.words = lhs.words;
+            out.kind = bitmap;
+            if (rhs.kind == bitmap)
+                bits::and_not_words(&out.words[0], &rhs.words[0], bitmap_words);
+            else
+                for (size_t i = 0; i < rhs.values.size(); ++i)
+                    out.words[rhs.values[i] / bits::word_bits] &= ~((uint64_t)1 << (rhs.values[i] % bits::word_bits));
+            out.cardinality = (uint32_t)bits::count(&out.words[0], bitmap_words);
+            out.normalize();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,459 @@
+#ifndef BITMAP_SET_HPP
+#define BITMAP_SET_HPP
+
+#include <stdexcept>
+#include <stdint.h>
+#include "set.hpp"
+#include "bitmap_chunk.hpp"
+#include "../iterator/bitmap_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+
+namespace ft
+{
+    template <class Integral>
+    class bitmap_set
+    {
+    public:
+        typedef Integral                                key_type;
+        typedef Integral                                value_type;
+        typedef ft::less<Integral>                      key_compare;
+        typedef key_compare                             value_compare;
+        typedef size_t                                  size_type;
+        typedef std::ptrdiff_t                          difference_type;
+        typedef value_type                              reference;
+        typedef value_type                              const_reference;
+        typedef ft::bitmap_iterator<bitmap_set>         iterator;
+        typedef iterator                                const_iterator;
+        typedef ft::reverse_iterator<iterator>          reverse_iterator;
+        typedef reverse_iterator                        const_reverse_iterator;
+
+        static_assert(ft::is_integral<Integral>::value, "ERROR: bitmap_set needs an integral key");
+
+        bitmap_set() : _size(0) {}
+
+        template <class Iter>
+        bitmap_set(Iter first, Iter last) : _size(0)
+        {
+            insert(first, last);
+        }
+
+        bitmap_set(const bitmap_set &other) : _size(0)
+        {
+            *this = other;
+        }
+
+        ~bitmap_set()
+        {
+            clear();
+        }
+
+        bitmap_set  &operator=(const bitmap_set &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                _chunks.reserve(other._chunks.size());
+                for (size_t i = 0; i < other._chunks.size(); ++i)
+                    _chunks.push_back(new bitmap_chunk(*other._chunks[i]));
+                _size = other._size;
+            }
+            return *this;
+        }
+
+        iterator    begin() const
+        {
+            size_t      slot = 0;
+            uint32_t    low = 0;
+
+            if (_chunks.empty())
+                return end();
+            _chunks[0]->first(slot, low);
+            return iterator(this, 0, slot, low);
+        }
+
+        iterator    end() const
+        {
+            return iterator(this, _chunks.size(), 0, 0);
+        }
+
+        reverse_iterator    rbegin() const
+        {
+            return reverse_iterator(end());
+        }
+
+        reverse_iterator    rend() const
+        {
+            return reverse_iterator(begin());
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        size_type   max_size() const
+        {
+            return (size_type)1 << (sizeof(value_type) * 8 < 63 ? sizeof(value_type) * 8 : 63);
+        }
+
+        ft::pair<iterator, bool>    insert(const value_type &value)
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+            bool        inserted;
+
+            if (index == _chunks.size() || _chunks[index]->key != key >> 16)
+                _chunks.insert(_chunks.begin() + index, new bitmap_chunk(key >> 16));
+            inserted = _chunks[index]->add(key & 0xffff);
+            _size += inserted;
+            return ft::make_pair(locate(index, key & 0xffff), inserted);
+        }
+
+        iterator    insert(iterator, const value_type &value)
+        {
+            return insert(value).first;
+        }
+
+        template <class Iter>
+        void        insert(Iter first, Iter last)
+        {
+            for (; first != last; ++first)
+                insert(*first);
+        }
+
+        size_type   erase(const key_type &value)
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+
+            if (index == _chunks.size() || _chunks[index]->key != key >> 16
+                || !_chunks[index]->remove(key & 0xffff))
+                return 0;
+            if (!_chunks[index]->cardinality)
+            {
+                delete _chunks[index];
+                _chunks.erase(_chunks.begin() + index);
+            }
+            --_size;
+            return 1;
+        }
+
+        void        erase(iterator position)
+        {
+            erase(*position);
+        }
+
+        void        clear()
+        {
+            for (size_t i = 0; i < _chunks.size(); ++i)
+                delete _chunks[i];
+            _chunks.clear();
+            _size = 0;
+        }
+
+        void        swap(bitmap_set &other)
+        {
+            _chunks.swap(other._chunks);
+            ft::swap(_size, other._size);
+        }
+
+        key_compare     key_comp() const
+        {
+            return key_compare();
+        }
+
+        value_compare   value_comp() const
+        {
+            return value_compare();
+        }
+
+        iterator        find(const key_type &value) const
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+
+            if (index == _chunks.size() || _chunks[index]->key != key >> 16
+                || !_chunks[index]->contains(key & 0xffff))
+                return end();
+            return locate(index, key & 0xffff);
+        }
+
+        size_type       count(const key_type &value) const
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+
+            return index < _chunks.size() && _chunks[index]->key == key >> 16
+                   && _chunks[index]->contains(key & 0xffff);
+        }
+
+        iterator        lower_bound(const key_type &value) const
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+            size_t      slot = 0;
+            uint32_t    low = 0;
+
+            if (index < _chunks.size() && _chunks[index]->key == key >> 16)
+            {
+                if (_chunks[index]->seek(key & 0xffff, slot, low))
+                    return iterator(this, index, slot, low);
+                ++index;
+            }
+            if (index == _chunks.size())
+                return end();
+            _chunks[index]->first(slot, low);
+            return iterator(this, index, slot, low);
+        }
+
+        iterator        upper_bound(const key_type &value) const
+        {
+            iterator    it = lower_bound(value);
+
+            if (it != end() && *it == value)
+                ++it;
+            return it;
+        }
+
+        ft::pair<iterator, iterator>    equal_range(const key_type &value) const
+        {
+            return ft::make_pair(lower_bound(value), upper_bound(value));
+        }
+
+        size_type   rank(const key_type &value) const
+        {
+            uint64_t    key = encode(value);
+            size_t      index = chunk_index(key >> 16);
+            size_type   rank = 0;
+
+            for (size_t i = 0; i < index; ++i)
+                rank += _chunks[i]->cardinality;
+            if (index < _chunks.size() && _chunks[index]->key == key >> 16)
+                rank += _chunks[index]->rank(key & 0xffff);
+            return rank;
+        }
+
+        value_type  select(size_type n) const
+        {
+            if (n >= _size)
+                throw std::out_of_range("ERROR: select position out of range");
+            for (size_t i = 0;; ++i)
+            {
+                if (n < _chunks[i]->cardinality)
+                    return value_at(i, _chunks[i]->select(n));
+                n -= _chunks[i]->cardinality;
+            }
+        }
+
+        bitmap_set  &operator|=(const bitmap_set &other)
+        {
+            if (this != &other)
+                combine(other, &bitmap_chunk::unite, true, true);
+            return *this;
+        }
+
+        bitmap_set  &operator&=(const bitmap_set &other)
+        {
+            if (this != &other)
+                combine(other, &bitmap_chunk::intersect, false, false);
+            return *this;
+        }
+
+        bitmap_set  &operator-=(const bitmap_set &other)
+        {
+            if (this == &other)
+                clear();
+            else
+                combine(other, &bitmap_chunk::subtract, true, false);
+            return *this;
+        }
+
+        void        optimize()
+        {
+            for (size_t i = 0; i < _chunks.size(); ++i)
+                _chunks[i]->optimize();
+            _chunks.shrink_to_fit();
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            size_t  chunks = 0;
+
+            for (size_t i = 0; i < _chunks.size(); ++i)
+                chunks += _chunks[i]->memory();
+            return memory_footprint(_size, chunks,
+                                    sizeof(*this) + chunks + _chunks.capacity() * sizeof(bitmap_chunk *));
+        }
+
+    private:
+        friend class ft::bitmap_iterator<bitmap_set>;
+
+        ft::vector<bitmap_chunk *>  _chunks;
+        size_type                   _size;
+
+        static uint64_t     bias()
+        {
+            return (value_type)-1 < (value_type)0 ? (uint64_t)1 << 63 : 0;
+        }
+
+        static uint64_t     encode(value_type value)
+        {
+            return (uint64_t)value ^ bias();
+        }
+
+        value_type  value_at(size_t chunk, uint32_t low) const
+        {
+            return (value_type)((_chunks[chunk]->key << 16 | low) ^ bias());
+        }
+
+        size_t      chunk_index(uint64_t high) const
+        {
+            size_t  first = 0;
+            size_t  count = _chunks.size();
+
+            while (count)
+            {
+                size_t  half = count / 2;
+
+                if (_chunks[first + half]->key < high)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                    count = half;
+            }
+            return first;
+        }
+
+        iterator    locate(size_t chunk, uint32_t low) const
+        {
+            size_t      slot = 0;
+            uint32_t    found = 0;
+
+            _chunks[chunk]->seek(low, slot, found);
+            return iterator(this, chunk, slot, found);
+        }
+
+        void        step_forward(size_t &chunk, size_t &slot, uint32_t &low) const
+        {
+            if (_chunks[chunk]->next(slot, low))
+                return;
+            if (++chunk < _chunks.size())
+                _chunks[chunk]->first(slot, low);
+            else
+            {
+                slot = 0;
+                low = 0;
+            }
+        }
+
+        void        step_backward(size_t &chunk, size_t &slot, uint32_t &low) const
+        {
+            if (chunk < _chunks.size() && _chunks[chunk]->prev(slot, low))
+                return;
+            _chunks[--chunk]->last(slot, low);
+        }
+
+        void        combine(const bitmap_set &other,
+                            void (*operation)(const bitmap_chunk &, const bitmap_chunk &, bitmap_chunk &),
+                            bool keep_own, bool keep_other)
+        {
+            ft::vector<bitmap_chunk *>  result;
+            size_t                      i = 0;
+            size_t                      j = 0;
+            size_type                   size = 0;
+
+            while (i < _chunks.size() || j < other._chunks.size())
+            {
+                if (j == other._chunks.size() || (i < _chunks.size() && _chunks[i]->key < other._chunks[j]->key))
+                {
+                    if (keep_own)
+                        result.push_back(_chunks[i]);
+                    else
+                        delete _chunks[i];
+                    ++i;
+                }
+                else if (i == _chunks.size() || other._chunks[j]->key < _chunks[i]->key)
+                {
+                    if (keep_other)
+                        result.push_back(new bitmap_chunk(*other._chunks[j]));
+                    ++j;
+                }
+                else
+                {
+                    bitmap_chunk    *out = new bitmap_chunk(_chunks[i]->key);
+
+                    operation(*_chunks[i], *other._chunks[j], *out);
+                    delete _chunks[i];
+                    if (out->cardinality)
+                        result.push_back(out);
+                    else
+                        delete out;
+                    ++i;
+                    ++j;
+                }
+            }
+            for (size_t k = 0; k < result.size(); ++k)
+                size += result[k]->cardinality;
+            _chunks.swap(result);
+            _size = size;
+        }
+    };
+
+    template <class Integral>
+    bitmap_set<Integral>    operator|(const bitmap_set<Integral> &lhs, const bitmap_set<Integral> &rhs)
+    {
+        bitmap_set<Integral>    result(lhs);
+
+        return result |= rhs;
+    }
+
+    template <class Integral>
+    bitmap_set<Integral>    operator&(const bitmap_set<Integral> &lhs, const bitmap_set<Integral> &rhs)
+    {
+        bitmap_set<Integral>    result(lhs);
+
+        return result &= rhs;
+    }
+
+    template <class Integral>
+    bitmap_set<Integral>    operator-(const bitmap_set<Integral> &lhs, const bitmap_set<Integral> &rhs)
+    {
+        bitmap_set<Integral>    result(lhs);
+
+        return result -= rhs;
+    }
+
+    template <class Integral>
+    bool    operator==(const bitmap_set<Integral> &lhs, const bitmap_set<Integral> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class Integral>
+    bool    operator!=(const bitmap_set<Integral> &lhs, const bitmap_set<Integral> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class Key, bool = ft::is_integral<Key>::value>
+    struct compact_set
+    {
+        typedef ft::set<Key>    type;
+    };
+
+    template <class Key>
+    struct compact_set<Key, true>
+    {
+        typedef ft::bitmap_set<Key> type;
+    };
+}
+
+#endif
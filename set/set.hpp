@@ -2,10 +2,15 @@
 #define SET_HPP
 
 #include <memory>
+#include <type_traits>
 #include "../utilities/utilities.hpp"
 #include "../iterator/red_black_tree_iterator.hpp"
 #include "../iterator/reverse_iterator.hpp"
 #include "../RBTree/red_black_tree.hpp"
+#include "../algorithm/parallel.hpp"
+#include "../utilities/image.hpp"
+#include "../utilities/bloom_filter.hpp"
+#include "../vector/vector.hpp"
 
 namespace ft
 {
@@ -34,6 +39,7 @@ namespace ft
         typedef typename ft::node<value_type>                                   *node_pointer;
 
         explicit set(const key_compare &comparator = key_compare(), const allocator_type &allocator = allocator_type())
+            : _tree(node_allocator_type(allocator))
         {
             _allocator = allocator;
             _root_child = _tree.create_node(value_type());
@@ -44,6 +50,7 @@ namespace ft
         template <class Iter>
         set(Iter first, Iter last, const key_compare &comparator = key_compare(),
                 const allocator_type &allocator = allocator_type())
+            : _tree(node_allocator_type(allocator))
         {
             _allocator = allocator;
             _root_child = _tree.create_node(value_type());
@@ -58,13 +65,42 @@ namespace ft
             _tree.clear(&_root_child);
         }
 
-        set(const set &other_set)
+        set(const set &other_set) : _tree(node_allocator_type(other_set._allocator))
         {
             _allocator = other_set._allocator;
             _root_child = _tree.create_node(value_type());
             _key_compare = other_set._key_compare;
             _size = other_set._size;
-            *this = other_set;
+            try
+            {
+                *this = other_set;
+            }
+            catch (...)
+            {
+                _tree.clear(&_root_child->parent);
+                _tree.delete_node(_root_child);
+                throw;
+            }
+        }
+
+        set(const set &other_set, const execution::parallel_policy &policy)
+            : _tree(node_allocator_type(other_set._allocator))
+        {
+            _allocator = other_set._allocator;
+            _root_child = _tree.create_node(value_type());
+            _key_compare = other_set._key_compare;
+            try
+            {
+                _root_child->parent = _tree.parallel_clone(&policy.executor(), other_set._root_child->parent);
+                _size = other_set._size;
+                _bloom = other_set._bloom;
+            }
+            catch (...)
+            {
+                _tree.clear(&_root_child->parent);
+                _tree.delete_node(_root_child);
+                throw;
+            }
         }
 
         set     &operator=(const set &other_set)
@@ -74,7 +110,9 @@ namespace ft
                 clear();
                 _allocator = other_set._allocator;
                 _key_compare = other_set._key_compare;
-                insert(other_set.begin(), other_set.end());
+                _root_child->parent = _tree.clone(other_set._root_child->parent, 0);
+                _size = other_set._size;
+                _bloom = other_set._bloom;
             }
             return *this;
         }
@@ -137,13 +175,15 @@ namespace ft
         ft::pair<iterator, bool>    insert(const value_type &value)
         {
             bool    result = _tree.insert(&_root_child->parent, _tree.create_node(value));
-            _size += result;
+            if (result)
+                inserted(value);
             return ft::pair<iterator, bool>(iterator(_root_child, _tree.find_node(_root_child->parent, value)), result);
         }
 
         iterator    insert(iterator, const value_type &value)
         {
-            _size += _tree.insert(&_root_child->parent, _tree.create_node(value));
+            if (_tree.insert(&_root_child->parent, _tree.create_node(value)))
+                inserted(value);
             return iterator(_root_child, _tree.find_node(_root_child->parent, value));
         }
 
@@ -156,13 +196,15 @@ namespace ft
 
         void        erase(iterator position)
         {
-            _size -= _tree.erase(&_root_child->parent, *position);
+            if (_tree.erase(&_root_child->parent, *position))
+                erased();
         }
 
         size_type   erase(const key_type &key)
         {
             bool    result = (bool)_tree.erase(&_root_child->parent, key);
-            _size -= result;
+            if (result)
+                erased();
             return result;
         }
 
@@ -180,6 +222,7 @@ namespace ft
             ft::swap(other_set._root_child, _root_child);
             ft::swap(other_set._key_compare, _key_compare);
             ft::swap(other_set._size, _size);
+            _bloom.swap(other_set._bloom);
         }
 
         void    clear()
@@ -187,6 +230,19 @@ namespace ft
             _tree.clear(&_root_child->parent);
             _root_child->parent = nullptr;
             _size = 0;
+            _bloom.clear();
+        }
+
+        void    clear(const execution::sequenced_policy &)
+        {
+            clear();
+        }
+
+        void    clear(const execution::parallel_policy &policy)
+        {
+            _tree.parallel_clear(&policy.executor(), &_root_child->parent);
+            _size = 0;
+            _bloom.clear();
         }
 
         key_compare     key_comp() const
@@ -201,16 +257,34 @@ namespace ft
 
         iterator        find(const key_type &key)
         {
+            if (rejected(key))
+                return end();
             return iterator(_root_child, _tree.find_node(_root_child->parent, key));
         }
 
         const_iterator  find(const key_type &key) const
         {
+            if (rejected(key))
+                return end();
             return const_iterator(_root_child, _tree.find_node(_root_child->parent, key));
         }
 
+        template <class InputIt, class OutputIt>
+        OutputIt        find_batch(InputIt first, InputIt last, OutputIt out)
+        {
+            return find_batch_into<iterator>(first, last, out);
+        }
+
+        template <class InputIt, class OutputIt>
+        OutputIt        find_batch(InputIt first, InputIt last, OutputIt out) const
+        {
+            return find_batch_into<const_iterator>(first, last, out);
+        }
+
         size_type       count(const key_type &key) const
         {
+            if (rejected(key))
+                return 0;
             return _tree.find_node(_root_child->parent, key) ? 1 : 0;
         }
 
@@ -257,12 +331,297 @@ namespace ft
             return _allocator;
         }
 
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, _size * sizeof(value_type),
+                                    sizeof(*this) + (_size + 1) * sizeof(ft::node<value_type>) + _bloom.memory());
+        }
+
+        void    enable_bloom_filter(double bits_per_key = 10)
+        {
+            static_assert(ft::bloom_hash<key_type>::enabled, "bloom filters require integral or std::string keys");
+            static_assert(std::is_same<key_compare, ft::less<key_type> >::value,
+                          "bloom filters require the default ft::less comparator");
+            rebuild_bloom_filter(bits_per_key);
+        }
+
+        void    disable_bloom_filter()
+        {
+            _bloom.release();
+        }
+
+        bool    bloom_filter_enabled() const
+        {
+            return _bloom.enabled();
+        }
+
+        void    rebuild_bloom_filter(double bits_per_key)
+        {
+            _bloom.reset(_size * 2 > 1024 ? _size * 2 : 1024, bits_per_key);
+            for (const_iterator it = begin(); it != end(); ++it)
+                _bloom.insert(ft::bloom_hash<key_type>::hash(*it));
+        }
+
+        tree_counters   counters() const
+        {
+            return _tree.counters();
+        }
+
+        void    reset_counters()
+        {
+            _tree.reset_counters();
+        }
+
+        tree_diagnostics    diagnostics() const
+        {
+            return _tree.diagnostics(_root_child->parent);
+        }
+
+        void    save(const char *path) const
+        {
+            static_assert(std::is_trivially_copyable<key_type>::value, "set images require trivially copyable keys");
+            write_image(path, begin(), end(), _size, sizeof(value_type), sizeof(key_type), 0);
+        }
+
+        template <class Function>
+        void    for_each(const execution::sequenced_policy &, Function function)
+        {
+            for_each_in(0, 0, 0, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::parallel_policy &policy, Function function)
+        {
+            for_each_in(&policy.executor(), 0, 0, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::sequenced_policy &, const key_type &first, const key_type &last,
+                         Function function)
+        {
+            for_each_in(0, &first, &last, function);
+        }
+
+        template <class Function>
+        void    for_each(const execution::parallel_policy &policy, const key_type &first, const key_type &last,
+                         Function function)
+        {
+            for_each_in(&policy.executor(), &first, &last, function);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::sequenced_policy &, U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(0, 0, 0, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::parallel_policy &policy, U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(&policy.executor(), 0, 0, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::sequenced_policy &, const key_type &first, const key_type &last,
+                       U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(0, &first, &last, init, operation, transform);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce(const execution::parallel_policy &policy, const key_type &first, const key_type &last,
+                       U init, Operation operation, Transform transform) const
+        {
+            return reduce_in(&policy.executor(), &first, &last, init, operation, transform);
+        }
+
+        class cursor
+        {
+        public:
+            explicit    cursor(set &owner) : _owner(&owner)
+            {
+                reset();
+            }
+
+            void    reset()
+            {
+                _finger = 0;
+                _rightmost = _owner->_tree.max_node(_owner->_root_child->parent);
+            }
+
+            iterator    position() const
+            {
+                return iterator(_owner->_root_child, _finger);
+            }
+
+            iterator    find(const key_type &key)
+            {
+                const value_type    &value = key;
+                node_pointer        node = 0;
+
+                if (!_rightmost || !_owner->_key_compare(_rightmost->value, value))
+                    node = _owner->_tree.find_node(start(value), value);
+                if (node)
+                    _finger = node;
+                return iterator(_owner->_root_child, node);
+            }
+
+            ft::pair<iterator, bool>    insert(const value_type &value)
+            {
+                node_pointer    node = _owner->_tree.create_node(value);
+                bool            past_end = !_rightmost || _owner->_key_compare(_rightmost->value, value);
+                bool            result;
+
+                result = _owner->_tree.insert_from(&_owner->_root_child->parent, start(value), node);
+                if (result)
+                    _owner->inserted(value);
+                if (result && past_end)
+                    _rightmost = node;
+                _finger = node;
+                return ft::pair<iterator, bool>(iterator(_owner->_root_child, node), result);
+            }
+
+            size_type   erase(const key_type &key)
+            {
+                const value_type    &value = key;
+                node_pointer        node = 0;
+
+                if (!_rightmost || !_owner->_key_compare(_rightmost->value, value))
+                    node = _owner->_tree.find_node(start(value), value);
+                if (!node)
+                    return 0;
+                _finger = _owner->_tree.next_node(node);
+                if (node == _rightmost)
+                    _rightmost = _owner->_tree.prev_node(node);
+                if (!_finger)
+                    _finger = _rightmost;
+                _owner->_tree.erase_node(&_owner->_root_child->parent, node);
+                _owner->erased();
+                return 1;
+            }
+
+        private:
+            set             *_owner;
+            node_pointer    _finger;
+            node_pointer    _rightmost;
+
+            node_pointer    start(const value_type &value) const
+            {
+                if (_rightmost && _owner->_key_compare(_rightmost->value, value))
+                    return _rightmost;
+                if (_finger)
+                    return _owner->_tree.finger_start(_finger, value);
+                return _owner->_root_child->parent;
+            }
+        };
+
     private:
         tree_type           _tree;
         allocator_type      _allocator;
         key_compare         _key_compare;
         size_type           _size;
         node_pointer        _root_child;
+        bloom_filter        _bloom;
+
+        void    inserted(const key_type &key)
+        {
+            ++_size;
+            if (!_bloom.enabled())
+                return;
+            if (_bloom.full())
+                rebuild_bloom_filter(_bloom.bits_per_key());
+            else
+                _bloom.insert(ft::bloom_hash<key_type>::hash(key));
+        }
+
+        void    erased()
+        {
+            --_size;
+            if (_bloom.enabled())
+            {
+                _bloom.erased();
+                if (_bloom.stale(_size))
+                    rebuild_bloom_filter(_bloom.bits_per_key());
+            }
+        }
+
+        bool    rejected(const key_type &key) const
+        {
+            return _bloom.enabled() && !_bloom.may_contain(ft::bloom_hash<key_type>::hash(key));
+        }
+
+        template <class U, class Operation, class Transform>
+        struct reducer
+        {
+            U           value;
+            bool        used;
+            Operation   operation;
+            Transform   transform;
+
+            void    operator()(const value_type &element)
+            {
+                if (used)
+                    value = operation(value, transform(element));
+                else
+                {
+                    value = transform(element);
+                    used = true;
+                }
+            }
+        };
+
+        template <class Function>
+        struct const_visitor
+        {
+            Function    function;
+
+            void    operator()(const value_type &element)
+            {
+                function(element);
+            }
+        };
+
+        template <class Function>
+        void    for_each_in(thread_pool *pool, const value_type *lower, const value_type *upper, Function function)
+        {
+            const_visitor<Function>                 visitor = {function};
+            ft::vector<const_visitor<Function> >    visitors(1, visitor);
+
+            _tree.parallel_visit(pool, _root_child->parent, lower, upper, visitors);
+        }
+
+        template <class U, class Operation, class Transform>
+        U       reduce_in(thread_pool *pool, const value_type *lower, const value_type *upper,
+                          U init, Operation operation, Transform transform) const
+        {
+            reducer<U, Operation, Transform>            prototype = {init, false, operation, transform};
+            ft::vector<reducer<U, Operation, Transform> > parts(1, prototype);
+
+            _tree.parallel_visit(pool, _root_child->parent, lower, upper, parts);
+            for (size_t i = 0; i < parts.size(); ++i)
+                if (parts[i].used)
+                    init = operation(init, parts[i].value);
+            return init;
+        }
+
+        template <class Iter, class InputIt, class OutputIt>
+        OutputIt    find_batch_into(InputIt first, InputIt last, OutputIt out) const
+        {
+            ft::vector<value_type>  keys;
+            node_pointer            found[tree_type::batch_width];
+
+            keys.reserve(tree_type::batch_width);
+            while (first != last)
+            {
+                keys.clear();
+                for (; first != last && keys.size() < tree_type::batch_width; ++first)
+                    keys.push_back(*first);
+                _tree.find_batch(_root_child->parent, &keys[0], keys.size(), found);
+                for (size_t i = 0; i < keys.size(); ++i)
+                    *out++ = Iter(_root_child, found[i]);
+            }
+            return out;
+        }
     };
 
     template <class Key, class Compare, class Allocator>
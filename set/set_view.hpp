@@ -0,0 +1,155 @@
+#ifndef SET_VIEW_HPP
+#define SET_VIEW_HPP
+
+#include <cstddef>
+#include "../utilities/utilities.hpp"
+#include "../utilities/image.hpp"
+
+namespace ft
+{
+    template <class Key, class Compare = ft::less<Key> >
+    class set_view
+    {
+    public:
+        typedef Key                                             key_type;
+        typedef Key                                             value_type;
+        typedef Compare                                         key_compare;
+        typedef Compare                                         value_compare;
+        typedef const value_type                                &const_reference;
+        typedef const value_type                                *const_pointer;
+        typedef ft::random_access_iterator<const value_type>    const_iterator;
+        typedef const_iterator                                  iterator;
+        typedef ft::reverse_iterator<const_iterator>            const_reverse_iterator;
+        typedef const_reverse_iterator                          reverse_iterator;
+        typedef std::ptrdiff_t                                  difference_type;
+        typedef std::size_t                                     size_type;
+
+        explicit    set_view(const key_compare &comparator = key_compare()) : _compare(comparator) {}
+
+        explicit    set_view(const char *path, const key_compare &comparator = key_compare()) : _compare(comparator)
+        {
+            open(path);
+        }
+
+        ~set_view() {}
+
+        void    open(const char *path)
+        {
+            _image.open(path, sizeof(value_type), sizeof(key_type), 0);
+        }
+
+        void    close()
+        {
+            _image.close();
+        }
+
+        bool    is_open() const
+        {
+            return _image.is_open();
+        }
+
+        const_iterator          begin() const
+        {
+            return const_iterator(data());
+        }
+
+        const_iterator          end() const
+        {
+            return const_iterator(data() + size());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        bool        empty() const
+        {
+            return !size();
+        }
+
+        size_type   size() const
+        {
+            return _image.count();
+        }
+
+        const_iterator  find(const key_type &key) const
+        {
+            const_pointer   it = lower(key);
+
+            return it != data() + size() && !_compare(key, *it) ? const_iterator(it) : end();
+        }
+
+        size_type       count(const key_type &key) const
+        {
+            return find(key) != end();
+        }
+
+        const_iterator  lower_bound(const key_type &key) const
+        {
+            return const_iterator(lower(key));
+        }
+
+        const_iterator  upper_bound(const key_type &key) const
+        {
+            const_pointer   it = lower(key);
+
+            if (it != data() + size() && !_compare(key, *it))
+                ++it;
+            return const_iterator(it);
+        }
+
+        ft::pair<const_iterator, const_iterator>    equal_range(const key_type &key) const
+        {
+            return ft::make_pair(lower_bound(key), upper_bound(key));
+        }
+
+        key_compare     key_comp() const
+        {
+            return _compare;
+        }
+
+        value_compare   value_comp() const
+        {
+            return _compare;
+        }
+
+    private:
+        image_mapping   _image;
+        key_compare     _compare;
+
+        set_view(const set_view &);
+        set_view    &operator=(const set_view &);
+
+        const_pointer   data() const
+        {
+            return static_cast<const_pointer>(_image.data());
+        }
+
+        const_pointer   lower(const key_type &key) const
+        {
+            const_pointer   base = data();
+            size_type       length = size();
+
+            if (!length)
+                return base;
+            while (length > 1)
+            {
+                size_type   half = length / 2;
+
+                ft::prefetch(base + half / 2);
+                ft::prefetch(base + half + half / 2);
+                base = _compare(base[half - 1], key) ? base + half : base;
+                length -= half;
+            }
+            return base + _compare(*base, key);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,351 @@
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <memory>
+#include <pthread.h>
+#include "../utilities/atomic.hpp"
+
+namespace ft
+{
+    template <class T, class Allocator = std::allocator<T> >
+    class concurrent_stack
+    {
+    public:
+        typedef T                                   value_type;
+        typedef Allocator                           allocator_type;
+        typedef typename allocator_type::size_type  size_type;
+
+        static const size_type  elimination_slots = 8;
+        static const size_type  elimination_spins = 64;
+
+        explicit    concurrent_stack(const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _node_allocator(alloc), _head(0), _free(0), _capacity(0)
+        {
+            for (size_type i = 0; i < max_segments; ++i)
+                _segments[i] = 0;
+            for (size_type i = 0; i < elimination_slots; ++i)
+                _slots[i].word = 0;
+            pthread_mutex_init(&_grow_lock, 0);
+        }
+
+        ~concurrent_stack()
+        {
+            word_type   top = _head;
+
+            while (index_of(top))
+            {
+                node    *current = at(index_of(top));
+
+                _allocator.destroy(&current->value);
+                top = current->next;
+            }
+            for (size_type i = 0; i < max_segments && _segments[i]; ++i)
+                _node_allocator.deallocate(_segments[i], segment_size(i));
+            pthread_mutex_destroy(&_grow_lock);
+        }
+
+        void    push(const value_type &value)
+        {
+            index_type  index = acquire_node();
+            node        *current = at(index);
+
+            try
+            {
+                _allocator.construct(&current->value, value);
+            }
+            catch (...)
+            {
+                splice(&_free, index, index);
+                throw;
+            }
+            for (size_type attempt = 0; ; ++attempt)
+            {
+                word_type   top = ft::atomic_load(&_head);
+
+                ft::atomic_store_relaxed(&current->next, index_of(top));
+                if (ft::atomic_compare_exchange(&_head, top, make_word(tag_of(top) + 1, index)))
+                    return;
+                if (eliminate_push(index, attempt))
+                    return;
+            }
+        }
+
+        bool    try_pop(value_type &out)
+        {
+            index_type  index = 0;
+
+            for (size_type attempt = 0; !index; ++attempt)
+            {
+                word_type   top = ft::atomic_load(&_head);
+
+                if (!index_of(top))
+                    return false;
+
+                node        *current = at(index_of(top));
+                index_type  next = ft::atomic_load_relaxed(&current->next);
+
+                if (ft::atomic_compare_exchange(&_head, top, make_word(tag_of(top) + 1, next)))
+                    index = index_of(top);
+                else
+                    index = eliminate_pop(attempt);
+            }
+            take(index, out);
+            return true;
+        }
+
+        template <class InputIterator>
+        void    push_range(InputIterator first, InputIterator last)
+        {
+            index_type  top = 0;
+            index_type  bottom = 0;
+
+            for (; first != last; ++first)
+            {
+                index_type  index = acquire_node();
+                node        *current = at(index);
+
+                try
+                {
+                    _allocator.construct(&current->value, *first);
+                }
+                catch (...)
+                {
+                    ft::atomic_store_relaxed(&current->next, top);
+                    for (index_type i = top; i; i = at(i)->next)
+                        _allocator.destroy(&at(i)->value);
+                    splice(&_free, index, bottom ? bottom : index);
+                    throw;
+                }
+                ft::atomic_store_relaxed(&current->next, top);
+                top = index;
+                if (!bottom)
+                    bottom = index;
+            }
+            if (top)
+                splice(&_head, top, bottom);
+        }
+
+        template <class OutputIterator>
+        size_type   pop_n(OutputIterator out, size_type count)
+        {
+            word_type   top = ft::atomic_load(&_head);
+            index_type  last;
+            size_type   taken;
+
+            do
+            {
+                last = 0;
+                taken = 0;
+                for (index_type index = index_of(top); index && taken < count; ++taken)
+                {
+                    last = index;
+                    index = ft::atomic_load_relaxed(&at(index)->next);
+                }
+                if (!taken)
+                    return 0;
+            }
+            while (!ft::atomic_compare_exchange(&_head, top,
+                        make_word(tag_of(top) + 1, ft::atomic_load_relaxed(&at(last)->next))));
+
+            index_type  index = index_of(top);
+
+            for (size_type i = 0; i < taken; ++i)
+            {
+                node    *current = at(index);
+
+                *out++ = current->value;
+                _allocator.destroy(&current->value);
+                index = current->next;
+            }
+            splice(&_free, index_of(top), last);
+            return taken;
+        }
+
+        bool    empty() const
+        {
+            return !index_of(ft::atomic_load(&_head));
+        }
+
+        allocator_type  get_allocator() const
+        {
+            return _allocator;
+        }
+
+    private:
+        typedef unsigned int        index_type;
+        typedef unsigned long long  word_type;
+
+        struct node
+        {
+            value_type  value;
+            index_type  next;
+        };
+
+        struct slot
+        {
+            word_type   word;
+            char        padding[ft::cache_line_size - sizeof(word_type)];
+        };
+
+        typedef typename Allocator::template rebind<node>::other    node_allocator_type;
+
+        static const size_type  max_segments = 25;
+        static const size_type  first_segment_shift = 6;
+        static const size_type  first_segment = (size_type)1 << first_segment_shift;
+
+        allocator_type      _allocator;
+        node_allocator_type _node_allocator;
+        char                _pad0[ft::cache_line_size];
+        word_type           _head;
+        char                _pad1[ft::cache_line_size - sizeof(word_type)];
+        word_type           _free;
+        char                _pad2[ft::cache_line_size - sizeof(word_type)];
+        slot                _slots[elimination_slots];
+        node                *_segments[max_segments];
+        size_type           _capacity;
+        pthread_mutex_t     _grow_lock;
+
+        concurrent_stack(const concurrent_stack &);
+        concurrent_stack    &operator=(const concurrent_stack &);
+
+        static word_type    make_word(word_type tag, index_type index)
+        {
+            return (tag << 32) | index;
+        }
+
+        static index_type   index_of(word_type word)
+        {
+            return (index_type)word;
+        }
+
+        static word_type    tag_of(word_type word)
+        {
+            return word >> 32;
+        }
+
+        static size_type    segment_size(size_type segment)
+        {
+            return first_segment << segment;
+        }
+
+        node    *at(index_type index) const
+        {
+            size_type   n = index - 1 + first_segment;
+            size_type   high = 63 - __builtin_clzll(n);
+            size_type   segment = high - first_segment_shift;
+
+            return _segments[segment] + (n - ((size_type)1 << high));
+        }
+
+        void    take(index_type index, value_type &out)
+        {
+            node    *current = at(index);
+
+            out = current->value;
+            _allocator.destroy(&current->value);
+            splice(&_free, index, index);
+        }
+
+        void    splice(word_type *head, index_type top, index_type bottom)
+        {
+            word_type   old = ft::atomic_load(head);
+
+            do
+                ft::atomic_store_relaxed(&at(bottom)->next, index_of(old));
+            while (!ft::atomic_compare_exchange(head, old, make_word(tag_of(old) + 1, top)));
+        }
+
+        index_type  acquire_node()
+        {
+            for (;;)
+            {
+                word_type   top = ft::atomic_load(&_free);
+
+                if (!index_of(top))
+                {
+                    grow();
+                    continue;
+                }
+
+                index_type  next = ft::atomic_load_relaxed(&at(index_of(top))->next);
+
+                if (ft::atomic_compare_exchange(&_free, top, make_word(tag_of(top) + 1, next)))
+                    return index_of(top);
+            }
+        }
+
+        void    grow()
+        {
+            pthread_mutex_lock(&_grow_lock);
+            if (!index_of(ft::atomic_load(&_free)))
+            {
+                size_type   segment = 0;
+
+                while (_segments[segment])
+                    ++segment;
+                if (segment == max_segments)
+                {
+                    pthread_mutex_unlock(&_grow_lock);
+                    throw std::bad_alloc();
+                }
+
+                size_type   count = segment_size(segment);
+                node        *nodes = _node_allocator.allocate(count);
+                index_type  first = _capacity + 1;
+
+                ft::atomic_store(&_segments[segment], nodes);
+                for (size_type i = 0; i + 1 < count; ++i)
+                    nodes[i].next = first + i + 1;
+                _capacity += count;
+                splice(&_free, first, first + count - 1);
+            }
+            pthread_mutex_unlock(&_grow_lock);
+        }
+
+        size_type   slot_for(size_type attempt) const
+        {
+            size_type   seed = (size_type)(&attempt) >> 4;
+
+            return (seed ^ attempt) % elimination_slots;
+        }
+
+        bool    eliminate_push(index_type index, size_type attempt)
+        {
+            word_type   *cell = &_slots[slot_for(attempt)].word;
+            word_type   current = ft::atomic_load(cell);
+
+            if (index_of(current))
+                return false;
+
+            word_type   offered = make_word(tag_of(current) + 1, index);
+
+            if (!ft::atomic_compare_exchange(cell, current, offered))
+                return false;
+            for (size_type spin = 0; spin < elimination_spins; ++spin)
+            {
+                if (ft::atomic_load(cell) != offered)
+                    return true;
+                ft::cpu_relax();
+            }
+            return !ft::atomic_compare_exchange(cell, offered, make_word(tag_of(offered) + 1, 0));
+        }
+
+        index_type  eliminate_pop(size_type attempt)
+        {
+            word_type   *cell = &_slots[slot_for(attempt)].word;
+
+            for (size_type spin = 0; spin < elimination_spins; ++spin)
+            {
+                word_type   current = ft::atomic_load(cell);
+
+                if (index_of(current) &&
+                    ft::atomic_compare_exchange(cell, current, make_word(tag_of(current) + 1, 0)))
+                    return index_of(current);
+                ft::cpu_relax();
+            }
+            return 0;
+        }
+    };
+}
+
+#endif
@@ -1,11 +1,12 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include "../deque/deque.hpp"
 #include "../vector/vector.hpp"
 
 namespace ft
 {
-    template<class T, class Container = ft::vector<T> >
+    template<class T, class Container = ft::deque<T> >
     class stack
     {
     public:
@@ -14,44 +15,56 @@ namespace ft
         typedef size_t      size_type;
 
     protected:
-        container_type      _container;
+        container_type      c;
 
     public:
-        explicit    stack(const container_type &c = container_type())
-        {
-            _container = c;
-        }
+        explicit    stack(const container_type &container = container_type()) : c(container) {}
 
         ~stack() {}
 
         value_type  &top()
         {
-            return _container.back();
+            return c.back();
         }
 
         const value_type    &top() const
         {
-            return _container.back();
+            return c.back();
         }
 
         bool    empty() const
         {
-            return _container.empty();
+            return c.empty();
         }
 
         size_type   size() const
         {
-            return _container.size();
+            return c.size();
         }
 
         void    push(const value_type &value)
         {
-            _container.push_back(value);
+            c.push_back(value);
         }
 
         void    pop()
         {
-            _container.pop_back();
+            c.pop_back();
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            return c.memory_usage();
+        }
+
+        void    shrink_to_fit()
+        {
+            c.shrink_to_fit();
+        }
+
+        void    set_shrink_policy(const shrink_policy &policy)
+        {
+            c.set_shrink_policy(policy);
         }
 
         template <class TF, class ContainerF>
@@ -76,37 +89,37 @@ namespace ft
     template <class TF, class ContainerF>
     bool operator==(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return (lhs._container == rhs._container);
+        return (lhs.c == rhs.c);
     }
 
     template <class TF, class ContainerF>
     bool operator!=(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return lhs._container != rhs._container;
+        return lhs.c != rhs.c;
     }
 
     template <class TF, class ContainerF>
     bool operator>(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return lhs._container > rhs._container;
+        return lhs.c > rhs.c;
     }
 
     template <class TF, class ContainerF>
     bool operator>=(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return lhs._container >= rhs._container;
+        return lhs.c >= rhs.c;
     }
 
     template <class TF, class ContainerF>
     bool operator<(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return lhs._container < rhs._container;
+        return lhs.c < rhs.c;
     }
 
     template <class TF, class ContainerF>
     bool operator<=(const ft::stack<TF, ContainerF> &lhs, const ft::stack<TF, ContainerF> &rhs)
     {
-        return lhs._container <= rhs._container;
+        return lhs.c <= rhs.c;
     }
 }
 
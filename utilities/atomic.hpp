@@ -0,0 +1,60 @@
+#ifndef ATOMIC_HPP
+#define ATOMIC_HPP
+
+namespace ft
+{
+    static const unsigned long  cache_line_size = 64;
+
+    template <class T>
+    inline T    atomic_load(const T *address)
+    {
+        return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+    }
+
+    template <class T>
+    inline T    atomic_load_relaxed(const T *address)
+    {
+        return __atomic_load_n(address, __ATOMIC_RELAXED);
+    }
+
+    template <class T>
+    inline void atomic_store(T *address, T value)
+    {
+        __atomic_store_n(address, value, __ATOMIC_RELEASE);
+    }
+
+    template <class T>
+    inline void atomic_store_relaxed(T *address, T value)
+    {
+        __atomic_store_n(address, value, __ATOMIC_RELAXED);
+    }
+
+    template <class T>
+    inline bool atomic_compare_exchange(T *address, T &expected, T desired)
+    {
+        return __atomic_compare_exchange_n(address, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+
+    template <class T>
+    inline T    atomic_fetch_add(T *address, T value)
+    {
+        return __atomic_fetch_add(address, value, __ATOMIC_ACQ_REL);
+    }
+
+    template <class T>
+    inline T    atomic_exchange(T *address, T value)
+    {
+        return __atomic_exchange_n(address, value, __ATOMIC_ACQ_REL);
+    }
+
+    inline void cpu_relax()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        __asm__ __volatile__("yield");
+#endif
+    }
+}
+
+#endif
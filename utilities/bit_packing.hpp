@@ -0,0 +1,136 @@
+#ifndef BIT_PACKING_HPP
+#define BIT_PACKING_HPP
+
+#include <cstddef>
+#include <stdint.h>
+#include "bit_words.hpp"
+
+namespace ft
+{
+    namespace bits
+    {
+        enum { pack_block = 128, pack_lanes = 2, pack_rows = pack_block / pack_lanes };
+
+        inline unsigned width_of(uint64_t value)
+        {
+#if defined(__GNUC__)
+            return value ? word_bits - (unsigned)__builtin_clzll(value) : 0;
+#else
+            unsigned    width = 0;
+
+            for (; value; value >>= 1)
+                ++width;
+            return width;
+#endif
+        }
+
+        inline size_t   packed_words(unsigned width)
+        {
+            return (size_t)width * pack_lanes;
+        }
+
+        inline void     pack(const uint64_t *values, unsigned width, uint64_t *out)
+        {
+            for (size_t i = 0; i < packed_words(width); ++i)
+                out[i] = 0;
+            for (unsigned lane = 0; lane < pack_lanes; ++lane)
+            {
+                size_t  bit = 0;
+
+                for (unsigned row = 0; row < pack_rows; ++row, bit += width)
+                {
+                    uint64_t    value = values[row * pack_lanes + lane];
+                    size_t      word = bit / word_bits;
+                    unsigned    shift = bit % word_bits;
+
+                    if (!width)
+                        continue;
+                    out[word * pack_lanes + lane] |= value << shift;
+                    if (shift + width > word_bits)
+                        out[(word + 1) * pack_lanes + lane] |= value >> (word_bits - shift);
+                }
+            }
+        }
+
+        inline uint64_t extract(const uint64_t *packed, unsigned width, size_t index)
+        {
+            size_t      bit = (size_t)(index / pack_lanes) * width;
+            unsigned    lane = index % pack_lanes;
+            size_t      word = bit / word_bits;
+            unsigned    shift = bit % word_bits;
+            uint64_t    mask = width == word_bits ? ~(uint64_t)0 : ((uint64_t)1 << width) - 1;
+            uint64_t    value;
+
+            if (!width)
+                return 0;
+            value = packed[word * pack_lanes + lane] >> shift;
+            if (shift + width > word_bits)
+                value |= packed[(word + 1) * pack_lanes + lane] << (word_bits - shift);
+            return value & mask;
+        }
+
+        template <unsigned Width>
+        void    unpack_width(const uint64_t *in, uint64_t *out)
+        {
+            const uint64_t  mask = Width == word_bits ? ~(uint64_t)0 : ((uint64_t)1 << (Width % word_bits)) - 1;
+            unsigned        shift = 0;
+
+            if (!Width)
+            {
+                for (unsigned i = 0; i < pack_block; ++i)
+                    out[i] = 0;
+                return;
+            }
+#if defined(__GNUC__)
+            const block     lane_mask = {mask, mask};
+            block           word = load(in);
+
+#pragma GCC unroll 64
+            for (unsigned row = 0; row < pack_rows; ++row)
+            {
+                block   value = word >> shift;
+
+                if (shift + Width > word_bits)
+                {
+                    in += pack_lanes;
+                    word = load(in);
+                    value |= word << (word_bits - shift);
+                    shift = shift + Width - word_bits;
+                }
+                else if (shift + Width == word_bits)
+                {
+                    in += pack_lanes;
+                    if (row + 1 < pack_rows)
+                        word = load(in);
+                    shift = 0;
+                }
+                else
+                    shift += Width;
+                store(out + row * pack_lanes, value & lane_mask);
+            }
+#else
+            for (unsigned i = 0; i < pack_block; ++i)
+                out[i] = extract(in, Width, i);
+            (void)mask;
+            (void)shift;
+#endif
+        }
+
+        inline void     unpack(const uint64_t *in, unsigned width, uint64_t *out)
+        {
+            typedef void    (*kernel)(const uint64_t *, uint64_t *);
+
+#define FT_UNPACK_4(n)  &unpack_width<n>, &unpack_width<n + 1>, &unpack_width<n + 2>, &unpack_width<n + 3>
+#define FT_UNPACK_16(n) FT_UNPACK_4(n), FT_UNPACK_4(n + 4), FT_UNPACK_4(n + 8), FT_UNPACK_4(n + 12)
+            static const kernel kernels[word_bits + 1] = {
+                FT_UNPACK_16(0), FT_UNPACK_16(16), FT_UNPACK_16(32), FT_UNPACK_16(48), &unpack_width<64>
+            };
+#undef FT_UNPACK_16
+#undef FT_UNPACK_4
+
+            kernels[width](in, out);
+        }
+    }
+}
+
+#endif
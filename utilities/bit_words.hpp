@@ -0,0 +1,237 @@
+#ifndef BIT_WORDS_HPP
+#define BIT_WORDS_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <stdint.h>
+
+namespace ft
+{
+    namespace bits
+    {
+        enum { word_bits = 64 };
+
+#if defined(__GNUC__)
+        typedef uint64_t    block __attribute__((vector_size(16)));
+
+        enum { block_words = sizeof(block) / sizeof(uint64_t) };
+
+        inline block    load(const uint64_t *words)
+        {
+            block   value;
+
+            std::memcpy(&value, words, sizeof(value));
+            return value;
+        }
+
+        inline void     store(uint64_t *words, block value)
+        {
+            std::memcpy(words, &value, sizeof(value));
+        }
+#endif
+
+        inline size_t   words_for(size_t bits)
+        {
+            return (bits + word_bits - 1) / word_bits;
+        }
+
+        inline uint64_t tail_mask(size_t bits)
+        {
+            return bits % word_bits ? ((uint64_t)1 << (bits % word_bits)) - 1 : ~(uint64_t)0;
+        }
+
+        inline unsigned popcount(uint64_t word)
+        {
+#if defined(__GNUC__) && (defined(__POPCNT__) || !(defined(__x86_64__) || defined(__i386__)))
+            return (unsigned)__builtin_popcountll(word);
+#else
+            word = word - ((word >> 1) & 0x5555555555555555ULL);
+            word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+            word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return (unsigned)((word * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        inline unsigned trailing_zeros(uint64_t word)
+        {
+#if defined(__GNUC__)
+            return (unsigned)__builtin_ctzll(word);
+#else
+            unsigned    count = 0;
+
+            while (!(word & 1))
+            {
+                word >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        inline size_t   count(const uint64_t *words, size_t size)
+        {
+            size_t  total = 0;
+            size_t  i = 0;
+
+#if defined(__GNUC__) && !defined(__POPCNT__) && (defined(__x86_64__) || defined(__i386__))
+            const block m1 = {0x5555555555555555ULL, 0x5555555555555555ULL};
+            const block m2 = {0x3333333333333333ULL, 0x3333333333333333ULL};
+            const block m4 = {0x0f0f0f0f0f0f0f0fULL, 0x0f0f0f0f0f0f0f0fULL};
+            const block m8 = {0x00ff00ff00ff00ffULL, 0x00ff00ff00ff00ffULL};
+
+            while (i + block_words <= size)
+            {
+                block   bytes = {0, 0};
+
+                for (size_t round = 0; round < 31 && i + block_words <= size; ++round, i += block_words)
+                {
+                    block   value = load(words + i);
+
+                    value = value - ((value >> 1) & m1);
+                    value = (value & m2) + ((value >> 2) & m2);
+                    bytes += (value + (value >> 4)) & m4;
+                }
+                bytes = (bytes & m8) + ((bytes >> 8) & m8);
+                bytes = bytes + (bytes >> 16);
+                bytes = bytes + (bytes >> 32);
+                for (size_t lane = 0; lane < block_words; ++lane)
+                    total += (size_t)(bytes[lane] & 0xffff);
+            }
+#endif
+            for (; i < size; ++i)
+                total += popcount(words[i]);
+            return total;
+        }
+
+        inline size_t   find_set(const uint64_t *words, size_t size, size_t from)
+        {
+            for (size_t i = from / word_bits; i < size; ++i)
+            {
+                uint64_t    word = words[i];
+
+                if (i == from / word_bits)
+                    word &= ~(uint64_t)0 << (from % word_bits);
+                if (word)
+                    return i * word_bits + trailing_zeros(word);
+            }
+            return size * word_bits;
+        }
+
+        inline size_t   find_unset(const uint64_t *words, size_t size, size_t from)
+        {
+            for (size_t i = from / word_bits; i < size; ++i)
+            {
+                uint64_t    word = ~words[i];
+
+                if (i == from / word_bits)
+                    word &= ~(uint64_t)0 << (from % word_bits);
+                if (word)
+                    return i * word_bits + trailing_zeros(word);
+            }
+            return size * word_bits;
+        }
+
+#if defined(__GNUC__)
+# define FT_BIT_WORDS_KERNEL(name, expression)                                  \
+        inline void name(uint64_t *lhs, const uint64_t *rhs, size_t size)       \
+        {                                                                       \
+            size_t  i = 0;                                                      \
+                                                                                \
+            for (; i + block_words <= size; i += block_words)                   \
+            {                                                                   \
+                block   a = load(lhs + i);                                      \
+                block   b = load(rhs + i);                                      \
+                                                                                \
+                store(lhs + i, expression);                                     \
+            }                                                                   \
+            for (; i < size; ++i)                                               \
+            {                                                                   \
+                uint64_t    a = lhs[i];                                         \
+                uint64_t    b = rhs[i];                                         \
+                                                                                \
+                lhs[i] = expression;                                            \
+            }                                                                   \
+        }
+#else
+# define FT_BIT_WORDS_KERNEL(name, expression)                                  \
+        inline void name(uint64_t *lhs, const uint64_t *rhs, size_t size)       \
+        {                                                                       \
+            for (size_t i = 0; i < size; ++i)                                   \
+            {                                                                   \
+                uint64_t    a = lhs[i];                                         \
+                uint64_t    b = rhs[i];                                         \
+                                                                                \
+                lhs[i] = expression;                                            \
+            }                                                                   \
+        }
+#endif
+
+        FT_BIT_WORDS_KERNEL(and_words, a & b)
+        FT_BIT_WORDS_KERNEL(or_words, a | b)
+        FT_BIT_WORDS_KERNEL(xor_words, a ^ b)
+        FT_BIT_WORDS_KERNEL(and_not_words, a & ~b)
+
+#undef FT_BIT_WORDS_KERNEL
+
+        inline void     flip_words(uint64_t *words, size_t size)
+        {
+            size_t  i = 0;
+
+#if defined(__GNUC__)
+            for (; i + block_words <= size; i += block_words)
+                store(words + i, ~load(words + i));
+#endif
+            for (; i < size; ++i)
+                words[i] = ~words[i];
+        }
+
+        inline uint64_t read_bits(const uint64_t *words, size_t pos, size_t count)
+        {
+            size_t      shift = pos % word_bits;
+            uint64_t    value = words[pos / word_bits] >> shift;
+
+            if (shift && shift + count > word_bits)
+                value |= words[pos / word_bits + 1] << (word_bits - shift);
+            return count < word_bits ? value & (((uint64_t)1 << count) - 1) : value;
+        }
+
+        inline void     write_bits(uint64_t *words, size_t pos, size_t count, uint64_t value)
+        {
+            size_t      shift = pos % word_bits;
+            uint64_t    mask = count < word_bits ? ((uint64_t)1 << count) - 1 : ~(uint64_t)0;
+            uint64_t    *word = words + pos / word_bits;
+
+            word[0] = (word[0] & ~(mask << shift)) | (value << shift);
+            if (shift + count > word_bits)
+            {
+                mask = ((uint64_t)1 << (shift + count - word_bits)) - 1;
+                word[1] = (word[1] & ~mask) | (value >> (word_bits - shift));
+            }
+        }
+
+        inline void     move_bits(uint64_t *words, size_t to, size_t from, size_t count)
+        {
+            if (to < from)
+            {
+                for (size_t done = 0; done < count; done += word_bits)
+                {
+                    size_t  chunk = count - done < word_bits ? count - done : (size_t)word_bits;
+
+                    write_bits(words, to + done, chunk, read_bits(words, from + done, chunk));
+                }
+            }
+            else if (to > from)
+            {
+                while (count)
+                {
+                    size_t  chunk = count < word_bits ? count : (size_t)word_bits;
+
+                    count -= chunk;
+                    write_bits(words, to + count, chunk, read_bits(words, from + count, chunk));
+                }
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,235 @@
+#ifndef BLOOM_FILTER_HPP
+#define BLOOM_FILTER_HPP
+
+#include <cstring>
+#include <new>
+#include <string>
+#include <stdint.h>
+#include <stdlib.h>
+#include "is_integral.hpp"
+
+namespace ft
+{
+    inline uint64_t mix_hash(uint64_t value)
+    {
+        value ^= value >> 30;
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27;
+        value *= 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+    template <class Key, bool = ft::is_integral<Key>::value>
+    struct bloom_hash
+    {
+        enum { enabled = 0 };
+
+        static uint64_t hash(const Key &)
+        {
+            return 0;
+        }
+    };
+
+    template <class Key>
+    struct bloom_hash<Key, true>
+    {
+        enum { enabled = 1 };
+
+        static uint64_t hash(const Key &key)
+        {
+            return mix_hash((uint64_t)key);
+        }
+    };
+
+    template <>
+    struct bloom_hash<std::string, false>
+    {
+        enum { enabled = 1 };
+
+        static uint64_t hash(const std::string &key)
+        {
+            uint64_t    value = 0xcbf29ce484222325ULL;
+
+            for (size_t i = 0; i < key.size(); ++i)
+                value = (value ^ (unsigned char)key[i]) * 0x100000001b3ULL;
+            return mix_hash(value);
+        }
+    };
+
+    class bloom_filter
+    {
+    public:
+        enum { block_words = 8, block_bytes = block_words * sizeof(uint64_t) };
+
+        bloom_filter() : _blocks(0), _count(0), _capacity(0), _inserted(0), _erased(0), _bits_per_key(0) {}
+
+        bloom_filter(const bloom_filter &other)
+            : _blocks(0), _count(0), _capacity(0), _inserted(0), _erased(0), _bits_per_key(0)
+        {
+            *this = other;
+        }
+
+        ~bloom_filter()
+        {
+            free(_blocks);
+        }
+
+        bloom_filter    &operator=(const bloom_filter &other)
+        {
+            if (this != &other)
+            {
+                allocate(other._count);
+                if (_count)
+                    std::memcpy(_blocks, other._blocks, _count * block_bytes);
+                _capacity = other._capacity;
+                _inserted = other._inserted;
+                _erased = other._erased;
+                _bits_per_key = other._bits_per_key;
+            }
+            return *this;
+        }
+
+        void    reset(size_t keys, double bits_per_key)
+        {
+            size_t  count = (size_t)(keys * bits_per_key / (block_bytes * 8)) + 1;
+
+            allocate(count);
+            std::memset(_blocks, 0, _count * block_bytes);
+            _capacity = (size_t)(_count * block_bytes * 8 / bits_per_key);
+            _inserted = 0;
+            _erased = 0;
+            _bits_per_key = bits_per_key;
+        }
+
+        void    release()
+        {
+            free(_blocks);
+            _blocks = 0;
+            _count = 0;
+            _capacity = 0;
+            _inserted = 0;
+            _erased = 0;
+            _bits_per_key = 0;
+        }
+
+        void    clear()
+        {
+            if (_count)
+                std::memset(_blocks, 0, _count * block_bytes);
+            _inserted = 0;
+            _erased = 0;
+        }
+
+        bool    enabled() const
+        {
+            return _count;
+        }
+
+        void    insert(uint64_t hash)
+        {
+            uint64_t    *block = _blocks + block_index(hash) * block_words;
+            uint32_t    seed = (uint32_t)hash;
+
+            for (unsigned i = 0; i < block_words; ++i)
+                block[i] |= (uint64_t)1 << ((seed * salt(i)) >> 26);
+            ++_inserted;
+        }
+
+        bool    may_contain(uint64_t hash) const
+        {
+            const uint64_t  *block = _blocks + block_index(hash) * block_words;
+            uint32_t        seed = (uint32_t)hash;
+            uint64_t        missing = 0;
+
+            for (unsigned i = 0; i < block_words; ++i)
+                missing |= ~block[i] & ((uint64_t)1 << ((seed * salt(i)) >> 26));
+            return !missing;
+        }
+
+        void    erased()
+        {
+            ++_erased;
+        }
+
+        bool    full() const
+        {
+            return _inserted > _capacity;
+        }
+
+        bool    stale(size_t size) const
+        {
+            return _erased > size && _erased > _capacity / 4;
+        }
+
+        double  bits_per_key() const
+        {
+            return _bits_per_key;
+        }
+
+        size_t  memory() const
+        {
+            return _count * block_bytes;
+        }
+
+        void    swap(bloom_filter &other)
+        {
+            bloom_filter    tmp;
+
+            tmp.adopt(*this);
+            adopt(other);
+            other.adopt(tmp);
+        }
+
+    private:
+        uint64_t    *_blocks;
+        size_t      _count;
+        size_t      _capacity;
+        size_t      _inserted;
+        size_t      _erased;
+        double      _bits_per_key;
+
+        static uint32_t salt(unsigned i)
+        {
+            static const uint32_t   salts[block_words] = {
+                0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+            };
+
+            return salts[i];
+        }
+
+        size_t  block_index(uint64_t hash) const
+        {
+            return (size_t)(((hash >> 32) * (uint64_t)_count) >> 32);
+        }
+
+        void    allocate(size_t count)
+        {
+            void    *memory = 0;
+
+            if (count == _count)
+                return;
+            if (count && posix_memalign(&memory, block_bytes, count * block_bytes))
+                throw std::bad_alloc();
+            free(_blocks);
+            _blocks = static_cast<uint64_t *>(memory);
+            _count = count;
+        }
+
+        void    adopt(bloom_filter &other)
+        {
+            free(_blocks);
+            _blocks = other._blocks;
+            _count = other._count;
+            _capacity = other._capacity;
+            _inserted = other._inserted;
+            _erased = other._erased;
+            _bits_per_key = other._bits_per_key;
+            other._blocks = 0;
+            other._count = 0;
+            other.release();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef IMAGE_HPP
+#define IMAGE_HPP
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ft
+{
+    struct image_header
+    {
+        char        magic[8];
+        uint32_t    version;
+        uint32_t    entry_size;
+        uint32_t    key_size;
+        uint32_t    mapped_size;
+        uint64_t    count;
+        uint64_t    data_offset;
+        char        reserved[24];
+    };
+
+    inline const char   *image_magic()
+    {
+        return "FTIMAGE";
+    }
+
+    inline std::runtime_error   image_error(const char *what, const char *path)
+    {
+        return std::runtime_error(std::string("ERROR: ") + what + " " + path + ": " + std::strerror(errno));
+    }
+
+    template <class InputIterator>
+    void    write_image(const char *path, InputIterator first, InputIterator last, uint64_t count,
+                        size_t entry_size, size_t key_size, size_t mapped_size)
+    {
+        image_header    header;
+        std::FILE       *file = std::fopen(path, "wb");
+
+        if (!file)
+            throw image_error("cannot create image", path);
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, image_magic(), sizeof(header.magic));
+        header.version = 1;
+        header.entry_size = (uint32_t)entry_size;
+        header.key_size = (uint32_t)key_size;
+        header.mapped_size = (uint32_t)mapped_size;
+        header.count = count;
+        header.data_offset = sizeof(header);
+
+        bool    written = std::fwrite(&header, sizeof(header), 1, file) == 1;
+
+        for (; written && first != last; ++first)
+            written = std::fwrite(&*first, entry_size, 1, file) == 1;
+        if (std::fclose(file) != 0 || !written)
+        {
+            std::remove(path);
+            throw image_error("cannot write image", path);
+        }
+    }
+
+    class image_mapping
+    {
+    public:
+        image_mapping() : _address(0), _length(0), _count(0), _data(0) {}
+
+        ~image_mapping()
+        {
+            close();
+        }
+
+        void        open(const char *path, size_t entry_size, size_t key_size, size_t mapped_size)
+        {
+            struct stat status;
+            int         fd = ::open(path, O_RDONLY);
+
+            close();
+            if (fd < 0)
+                throw image_error("cannot open image", path);
+            if (fstat(fd, &status) != 0 || (size_t)status.st_size < sizeof(image_header))
+            {
+                ::close(fd);
+                errno = EINVAL;
+                throw image_error("invalid image", path);
+            }
+
+            void    *address = mmap(0, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            ::close(fd);
+            if (address == MAP_FAILED)
+                throw image_error("cannot map image", path);
+
+            const image_header  *header = static_cast<const image_header *>(address);
+
+            if (std::memcmp(header->magic, image_magic(), sizeof(header->magic)) || header->version != 1
+                || header->entry_size != entry_size || header->key_size != key_size
+                || header->mapped_size != mapped_size || header->data_offset < sizeof(image_header)
+                || header->data_offset > (uint64_t)status.st_size
+                || header->count > ((uint64_t)status.st_size - header->data_offset) / entry_size)
+            {
+                munmap(address, (size_t)status.st_size);
+                errno = EINVAL;
+                throw image_error("invalid image", path);
+            }
+            _address = address;
+            _length = (size_t)status.st_size;
+            _count = (size_t)header->count;
+            _data = static_cast<const char *>(address) + header->data_offset;
+            madvise(_address, _length, MADV_RANDOM);
+        }
+
+        void        close()
+        {
+            if (_address)
+                munmap(_address, _length);
+            _address = 0;
+            _length = 0;
+            _count = 0;
+            _data = 0;
+        }
+
+        bool        is_open() const
+        {
+            return _address != 0;
+        }
+
+        size_t      count() const
+        {
+            return _count;
+        }
+
+        const void  *data() const
+        {
+            return _data;
+        }
+
+    private:
+        void        *_address;
+        size_t      _length;
+        size_t      _count;
+        const char  *_data;
+
+        image_mapping(const image_mapping &);
+        image_mapping   &operator=(const image_mapping &);
+    };
+}
+
+#endif
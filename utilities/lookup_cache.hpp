@@ -0,0 +1,138 @@
+#ifndef LOOKUP_CACHE_HPP
+#define LOOKUP_CACHE_HPP
+
+#include <cstring>
+#include <new>
+#include <stdint.h>
+#include <stdlib.h>
+#include "atomic.hpp"
+
+namespace ft
+{
+    template <class Node>
+    class lookup_cache
+    {
+    public:
+        enum { ways = 8 };
+
+        lookup_cache() : _entries(0), _sets(0)
+        {
+        }
+
+        ~lookup_cache()
+        {
+            free(_entries);
+        }
+
+        void    reset(size_t capacity)
+        {
+            size_t  sets = 1;
+
+            while (sets * ways < capacity)
+                sets <<= 1;
+            if (sets != _sets)
+            {
+                void    *memory = 0;
+
+                if (posix_memalign(&memory, sizeof(uint64_t) * ways, sets * ways * sizeof(uint64_t)))
+                    throw std::bad_alloc();
+                free(_entries);
+                _entries = static_cast<uint64_t *>(memory);
+                _sets = sets;
+            }
+            clear();
+        }
+
+        void    release()
+        {
+            free(_entries);
+            _entries = 0;
+            _sets = 0;
+        }
+
+        void    clear()
+        {
+            if (_sets)
+                std::memset(_entries, 0, _sets * ways * sizeof(uint64_t));
+        }
+
+        bool    enabled() const
+        {
+            return _sets;
+        }
+
+        size_t  capacity() const
+        {
+            return _sets * ways;
+        }
+
+        Node    *find(uint64_t hash) const
+        {
+            const uint64_t  *set = _entries + (hash & (_sets - 1)) * ways;
+
+            for (unsigned i = 0; i < ways; ++i)
+            {
+                uint64_t    entry = ft::atomic_load_relaxed(set + i);
+
+                if (entry && (entry & tag_mask) == (hash & tag_mask))
+                    return reinterpret_cast<Node *>(entry & ~tag_mask);
+            }
+            return 0;
+        }
+
+        void    store(uint64_t hash, Node *node) const
+        {
+            uint64_t    *set = _entries + (hash & (_sets - 1)) * ways;
+            uint64_t    entry = reinterpret_cast<uintptr_t>(node);
+            unsigned    victim = (hash >> 32) & (ways - 1);
+
+            if (entry & tag_mask)
+                return;
+            for (unsigned i = 0; i < ways; ++i)
+            {
+                if (!ft::atomic_load_relaxed(set + i))
+                {
+                    victim = i;
+                    break;
+                }
+            }
+            ft::atomic_store_relaxed(set + victim, entry | (hash & tag_mask));
+        }
+
+        void    invalidate(uint64_t hash)
+        {
+            uint64_t    *set = _entries + (hash & (_sets - 1)) * ways;
+
+            for (unsigned i = 0; i < ways; ++i)
+                if ((set[i] & tag_mask) == (hash & tag_mask))
+                    set[i] = 0;
+        }
+
+        size_t  memory() const
+        {
+            return _sets * ways * sizeof(uint64_t);
+        }
+
+        void    swap(lookup_cache &other)
+        {
+            uint64_t    *entries = _entries;
+            size_t      sets = _sets;
+
+            _entries = other._entries;
+            _sets = other._sets;
+            other._entries = entries;
+            other._sets = sets;
+        }
+
+    private:
+        static const uint64_t   tag_mask = 0xffff000000000000ULL;
+
+        uint64_t    *_entries;
+        size_t      _sets;
+
+        lookup_cache(const lookup_cache &);
+        lookup_cache    &operator=(const lookup_cache &);
+    };
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef MEMORY_FOOTPRINT_HPP
+#define MEMORY_FOOTPRINT_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+    struct memory_footprint
+    {
+        size_t  elements;
+        size_t  element_bytes;
+        size_t  allocated_bytes;
+        size_t  overhead_bytes;
+
+        memory_footprint() : elements(0), element_bytes(0), allocated_bytes(0), overhead_bytes(0) {}
+
+        memory_footprint(size_t count, size_t payload, size_t allocated)
+            : elements(count), element_bytes(payload), allocated_bytes(allocated),
+              overhead_bytes(allocated - payload) {}
+
+        double  overhead_per_element() const
+        {
+            return elements ? (double)overhead_bytes / elements : (double)overhead_bytes;
+        }
+
+        memory_footprint    &operator+=(const memory_footprint &other)
+        {
+            elements += other.elements;
+            element_bytes += other.element_bytes;
+            allocated_bytes += other.allocated_bytes;
+            overhead_bytes += other.overhead_bytes;
+            return *this;
+        }
+    };
+}
+
+#endif
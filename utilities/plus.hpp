@@ -0,0 +1,18 @@
+#ifndef PLUS_HPP
+#define PLUS_HPP
+
+#include "less.hpp"
+
+namespace ft
+{
+    template <class T>
+    struct plus : less_function<T, T, T>
+    {
+        T   operator()(const T &lhs, const T &rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef PREFETCH_HPP
+#define PREFETCH_HPP
+
+namespace ft
+{
+    template <class T>
+    inline void prefetch(const T *address)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address, 0, 3);
+#else
+        (void)address;
+#endif
+    }
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef RADIX_KEY_HPP
+#define RADIX_KEY_HPP
+
+#include <string>
+#include <stdint.h>
+#include "is_integral.hpp"
+
+namespace ft
+{
+    template <class Key, bool = ft::is_integral<Key>::value>
+    struct radix_key;
+
+    template <class Key>
+    struct radix_key<Key, true>
+    {
+        static void encode(const Key &key, std::string &bytes)
+        {
+            uint64_t    value = (uint64_t)key;
+
+            if ((Key)-1 < (Key)0)
+                value ^= (uint64_t)1 << (sizeof(Key) * 8 - 1);
+            bytes.resize(sizeof(Key));
+            for (size_t i = sizeof(Key); i > 0; --i, value >>= 8)
+                bytes[i - 1] = (char)(value & 0xff);
+        }
+    };
+
+    template <>
+    struct radix_key<std::string, false>
+    {
+        static void encode(const std::string &key, std::string &bytes)
+        {
+            bytes.clear();
+            bytes.reserve(key.size() + 2);
+            for (size_t i = 0; i < key.size(); ++i)
+            {
+                bytes.push_back(key[i]);
+                if (!key[i])
+                    bytes.push_back('\xff');
+            }
+            bytes.push_back('\0');
+            bytes.push_back('\0');
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef SHRINK_POLICY_HPP
+#define SHRINK_POLICY_HPP
+
+#include <cstddef>
+
+namespace ft
+{
+    struct shrink_policy
+    {
+        size_t  shrink_below;
+        size_t  shrink_factor;
+        size_t  minimum_capacity;
+
+        explicit shrink_policy(size_t below = 0, size_t factor = 2, size_t minimum = 0)
+            : shrink_below(below), shrink_factor(factor > 1 ? factor : 2), minimum_capacity(minimum) {}
+
+        static shrink_policy    never()
+        {
+            return shrink_policy();
+        }
+
+        static shrink_policy    hysteresis(size_t below = 4, size_t factor = 2, size_t minimum = 16)
+        {
+            return shrink_policy(below, factor, minimum);
+        }
+
+        bool    enabled() const
+        {
+            return shrink_below != 0;
+        }
+
+        size_t  target(size_t size, size_t capacity) const
+        {
+            if (!enabled())
+                return capacity;
+            while (capacity > minimum_capacity && size < capacity / shrink_below)
+                capacity /= shrink_factor;
+            if (capacity < minimum_capacity)
+                capacity = minimum_capacity;
+            return capacity < size ? size : capacity;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef STATS_ALLOCATOR_HPP
+#define STATS_ALLOCATOR_HPP
+
+#include <memory>
+#include "atomic.hpp"
+
+namespace ft
+{
+    struct allocation_stats
+    {
+        static const size_t histogram_buckets = 48;
+
+        size_t  allocations;
+        size_t  deallocations;
+        size_t  allocated_bytes;
+        size_t  live_bytes;
+        size_t  peak_bytes;
+        size_t  histogram[histogram_buckets];
+
+        allocation_stats()
+        {
+            reset();
+        }
+
+        void    reset()
+        {
+            allocations = 0;
+            deallocations = 0;
+            allocated_bytes = 0;
+            live_bytes = 0;
+            peak_bytes = 0;
+            for (size_t i = 0; i < histogram_buckets; ++i)
+                histogram[i] = 0;
+        }
+
+        static size_t   bucket(size_t bytes)
+        {
+            size_t  index = 0;
+
+            while (index + 1 < histogram_buckets && ((size_t)1 << index) < bytes)
+                ++index;
+            return index;
+        }
+
+        static size_t   bucket_limit(size_t index)
+        {
+            return (size_t)1 << index;
+        }
+
+        void    record_allocate(size_t bytes)
+        {
+            size_t  live = ft::atomic_fetch_add(&live_bytes, bytes) + bytes;
+            size_t  peak = ft::atomic_load_relaxed(&peak_bytes);
+
+            ft::atomic_fetch_add(&allocations, (size_t)1);
+            ft::atomic_fetch_add(&allocated_bytes, bytes);
+            ft::atomic_fetch_add(&histogram[bucket(bytes)], (size_t)1);
+            while (live > peak && !ft::atomic_compare_exchange(&peak_bytes, peak, live))
+                ;
+        }
+
+        void    record_deallocate(size_t bytes)
+        {
+            ft::atomic_fetch_add(&deallocations, (size_t)1);
+            ft::atomic_fetch_add(&live_bytes, (size_t)0 - bytes);
+        }
+
+        static allocation_stats &global()
+        {
+            static allocation_stats stats;
+
+            return stats;
+        }
+    };
+
+    template <class T, class Base = std::allocator<T> >
+    class stats_allocator : public Base
+    {
+    public:
+        typedef typename Base::value_type       value_type;
+        typedef typename Base::pointer          pointer;
+        typedef typename Base::const_pointer    const_pointer;
+        typedef typename Base::reference        reference;
+        typedef typename Base::const_reference  const_reference;
+        typedef typename Base::size_type        size_type;
+        typedef typename Base::difference_type  difference_type;
+
+        template <class U>
+        struct rebind
+        {
+            typedef stats_allocator<U, typename Base::template rebind<U>::other>    other;
+        };
+
+        stats_allocator() : Base(), _stats(&allocation_stats::global()) {}
+
+        explicit    stats_allocator(allocation_stats &stats, const Base &base = Base()) : Base(base), _stats(&stats) {}
+
+        stats_allocator(const stats_allocator &other) : Base(other), _stats(other._stats) {}
+
+        template <class U, class OtherBase>
+        stats_allocator(const stats_allocator<U, OtherBase> &other) : Base(other.base()), _stats(&other.stats()) {}
+
+        ~stats_allocator() {}
+
+        stats_allocator &operator=(const stats_allocator &other)
+        {
+            Base::operator=(other);
+            _stats = other._stats;
+            return *this;
+        }
+
+        pointer     allocate(size_type count, const void *hint = 0)
+        {
+            pointer result = Base::allocate(count, hint);
+
+            _stats->record_allocate(count * sizeof(value_type));
+            return result;
+        }
+
+        void        deallocate(pointer data, size_type count)
+        {
+            if (data)
+                _stats->record_deallocate(count * sizeof(value_type));
+            Base::deallocate(data, count);
+        }
+
+        allocation_stats    &stats() const
+        {
+            return *_stats;
+        }
+
+        const Base  &base() const
+        {
+            return *this;
+        }
+
+    private:
+        allocation_stats    *_stats;
+    };
+
+    template <class T1, class Base1, class T2, class Base2>
+    bool    operator==(const stats_allocator<T1, Base1> &lhs, const stats_allocator<T2, Base2> &rhs)
+    {
+        return &lhs.stats() == &rhs.stats();
+    }
+
+    template <class T1, class Base1, class T2, class Base2>
+    bool    operator!=(const stats_allocator<T1, Base1> &lhs, const stats_allocator<T2, Base2> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif
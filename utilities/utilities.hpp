@@ -11,9 +11,13 @@
 #include "equal.hpp"
 #include "is_integral.hpp"
 #include "less.hpp"
+#include "memory_footprint.hpp"
+#include "shrink_policy.hpp"
 #include "lexicographical_compare.hpp"
 #include "pair.hpp"
 #include "pair_compare.hpp"
+#include "plus.hpp"
+#include "prefetch.hpp"
 #include "swap.hpp"
 #include "switch_const.hpp"
 
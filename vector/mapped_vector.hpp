@@ -0,0 +1,488 @@
+#ifndef MAPPED_VECTOR_HPP
+#define MAPPED_VECTOR_HPP
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <stdint.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../iterator/random_access_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+
+namespace ft
+{
+    template <class T>
+    class mapped_vector
+    {
+    public:
+        typedef T                                                       value_type;
+        typedef std::size_t                                             size_type;
+        typedef T                                                       &reference;
+        typedef const T                                                 &const_reference;
+        typedef T                                                       *pointer;
+        typedef const T                                                 *const_pointer;
+        typedef ft::random_access_iterator<value_type>                  iterator;
+        typedef ft::random_access_iterator<const value_type>            const_iterator;
+        typedef ft::reverse_iterator<iterator>                          reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                    const_reverse_iterator;
+        typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+        enum access { normal, sequential, random, will_need, dont_need };
+
+        mapped_vector() : _fd(-1), _address(0), _length(0), _header(0), _data(0), _capacity(0)
+        {
+            open_temporary();
+        }
+
+        explicit    mapped_vector(const char *path)
+            : _fd(-1), _address(0), _length(0), _header(0), _data(0), _capacity(0)
+        {
+            open(path);
+        }
+
+        ~mapped_vector()
+        {
+            close();
+        }
+
+        void    open(const char *path)
+        {
+            struct stat status;
+
+            close();
+            _fd = ::open(path, O_RDWR | O_CREAT, 0644);
+            if (_fd < 0)
+                throw error("cannot open", path);
+            if (fstat(_fd, &status) != 0)
+                fail(errno, "cannot stat", path);
+            if (!status.st_size)
+                return initialize();
+            if ((size_t)status.st_size < sizeof(header))
+                fail(EINVAL, "invalid mapped_vector file", path);
+            attach(mmap(0, (size_t)status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0), (size_t)status.st_size);
+            if (std::memcmp(_header->magic, magic(), sizeof(_header->magic))
+                || _header->element_size != sizeof(value_type) || _header->size > _capacity)
+                fail(EINVAL, "invalid mapped_vector file", path);
+        }
+
+        void    close()
+        {
+            if (_address)
+                munmap(_address, _length);
+            if (_fd >= 0)
+                ::close(_fd);
+            _fd = -1;
+            _address = 0;
+            _length = 0;
+            _header = 0;
+            _data = 0;
+            _capacity = 0;
+        }
+
+        bool    is_open() const
+        {
+            return _fd >= 0;
+        }
+
+        void    flush(bool wait = true)
+        {
+            if (_address && msync(_address, _length, wait ? MS_SYNC : MS_ASYNC) != 0)
+                throw error("cannot flush", "mapping");
+        }
+
+        void    advise(access hint)
+        {
+            static const int    advice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED};
+
+            if (_address)
+                madvise(_address, _length, advice[hint]);
+        }
+
+        iterator        begin()
+        {
+            return _data;
+        }
+
+        const_iterator  begin() const
+        {
+            return _data;
+        }
+
+        iterator        end()
+        {
+            return _data + size();
+        }
+
+        const_iterator  end() const
+        {
+            return _data + size();
+        }
+
+        reverse_iterator        rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator        rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        size_type   size() const
+        {
+            return _header ? (size_type)_header->size : 0;
+        }
+
+        size_type   max_size() const
+        {
+            return (std::numeric_limits<size_type>::max() - sizeof(header)) / sizeof(value_type);
+        }
+
+        size_type   capacity() const
+        {
+            return _capacity;
+        }
+
+        bool        empty() const
+        {
+            return !size();
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(size(), size() * sizeof(value_type), sizeof(*this) + _length);
+        }
+
+        void    reserve(size_type count)
+        {
+            if (count > max_size())
+                throw std::length_error("ERROR: mapped_vector size limit exceeded");
+            if (count > _capacity)
+                remap(count);
+        }
+
+        void    shrink_to_fit()
+        {
+            if (_address && size() < _capacity)
+                remap(size());
+        }
+
+        void    resize(size_type count, value_type value = value_type())
+        {
+            if (count > size())
+                insert(end(), count - size(), value);
+            else
+                set_size(count);
+        }
+
+        reference       operator[](size_type index)
+        {
+            return _data[index];
+        }
+
+        const_reference operator[](size_type index) const
+        {
+            return _data[index];
+        }
+
+        reference       at(size_type index)
+        {
+            if (index < size())
+                return _data[index];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        const_reference at(size_type index) const
+        {
+            if (index < size())
+                return _data[index];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        reference       front()
+        {
+            return _data[0];
+        }
+
+        const_reference front() const
+        {
+            return _data[0];
+        }
+
+        reference       back()
+        {
+            return _data[size() - 1];
+        }
+
+        const_reference back() const
+        {
+            return _data[size() - 1];
+        }
+
+        pointer         data()
+        {
+            return _data;
+        }
+
+        const_pointer   data() const
+        {
+            return _data;
+        }
+
+        void    assign(size_type count, const value_type &value)
+        {
+            clear();
+            insert(end(), count, value);
+        }
+
+        template <class InputIterator>
+        void    assign(InputIterator first, InputIterator last,
+                       typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            clear();
+            insert(end(), first, last);
+        }
+
+        void    clear()
+        {
+            set_size(0);
+        }
+
+        void    push_back(const value_type &value)
+        {
+            size_type   count = size();
+
+            if (count == _capacity)
+            {
+                value_type  copy(value);
+
+                grow(count + 1);
+                _data[count] = copy;
+            }
+            else
+                _data[count] = value;
+            set_size(count + 1);
+        }
+
+        void    pop_back()
+        {
+            if (size())
+                set_size(size() - 1);
+        }
+
+        iterator    insert(iterator pos, const value_type &value)
+        {
+            size_type   index = ft::distance(begin(), pos);
+
+            insert(pos, 1, value);
+            return begin() + index;
+        }
+
+        void        insert(iterator pos, size_type count, const value_type &value)
+        {
+            size_type   index = ft::distance(begin(), pos);
+            size_type   old_size = size();
+            value_type  copy(value);
+
+            grow(old_size + count);
+            std::memmove(_data + index + count, _data + index, (old_size - index) * sizeof(value_type));
+            for (size_type i = 0; i < count; ++i)
+                _data[index + i] = copy;
+            set_size(old_size + count);
+        }
+
+        template <class InputIterator>
+        void        insert(iterator pos, InputIterator first, InputIterator last,
+                           typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            size_type   index = ft::distance(begin(), pos);
+            size_type   old_size = size();
+            size_type   count = ft::distance(first, last);
+
+            grow(old_size + count);
+            std::memmove(_data + index + count, _data + index, (old_size - index) * sizeof(value_type));
+            for (size_type i = 0; first != last; ++first, ++i)
+                _data[index + i] = *first;
+            set_size(old_size + count);
+        }
+
+        iterator    erase(iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator    erase(iterator first, iterator last)
+        {
+            size_type   index = ft::distance(begin(), first);
+            size_type   count = ft::distance(first, last);
+
+            std::memmove(_data + index, _data + index + count, (size() - index - count) * sizeof(value_type));
+            set_size(size() - count);
+            return begin() + index;
+        }
+
+        void    swap(mapped_vector &other)
+        {
+            ft::swap(_fd, other._fd);
+            ft::swap(_address, other._address);
+            ft::swap(_length, other._length);
+            ft::swap(_header, other._header);
+            ft::swap(_data, other._data);
+            ft::swap(_capacity, other._capacity);
+        }
+
+    private:
+        static_assert(std::is_trivially_copyable<T>::value, "mapped_vector requires a trivially copyable type");
+
+        struct header
+        {
+            char        magic[8];
+            uint64_t    element_size;
+            uint64_t    size;
+            char        reserved[40];
+        };
+
+        int         _fd;
+        void        *_address;
+        size_type   _length;
+        header      *_header;
+        pointer     _data;
+        size_type   _capacity;
+
+        mapped_vector(const mapped_vector &);
+        mapped_vector   &operator=(const mapped_vector &);
+
+        static const char   *magic()
+        {
+            return "FTVECTOR";
+        }
+
+        static std::runtime_error   error(const char *what, const char *path)
+        {
+            return std::runtime_error(std::string("ERROR: ") + what + " " + path + ": " + std::strerror(errno));
+        }
+
+        void    fail(int code, const char *what, const char *path)
+        {
+            close();
+            errno = code;
+            throw error(what, path);
+        }
+
+        void    open_temporary()
+        {
+            const char  *directory = std::getenv("TMPDIR");
+            std::string path = std::string(directory && *directory ? directory : "/tmp") + "/ft_mapped_vector.XXXXXX";
+
+            _fd = mkstemp(&path[0]);
+            if (_fd < 0)
+                throw error("cannot create", path.c_str());
+            unlink(path.c_str());
+            initialize();
+        }
+
+        void    initialize()
+        {
+            remap(0);
+            std::memcpy(_header->magic, magic(), sizeof(_header->magic));
+            _header->element_size = sizeof(value_type);
+            _header->size = 0;
+        }
+
+        void    set_size(size_type count)
+        {
+            _header->size = count;
+        }
+
+        void    grow(size_type count)
+        {
+            if (count > _capacity)
+                reserve(count > _capacity * 2 ? count : _capacity * 2);
+        }
+
+        void    remap(size_type count)
+        {
+            size_type   page = (size_type)sysconf(_SC_PAGESIZE);
+            size_type   length = (sizeof(header) + count * sizeof(value_type) + page - 1) / page * page;
+            size_type   old_length = _length;
+
+            if (length == old_length)
+                return;
+            if (length > old_length && ftruncate(_fd, (off_t)length) != 0)
+                throw error("cannot grow", "mapping");
+            if (_address)
+                attach(mremap(_address, _length, length, MREMAP_MAYMOVE), length);
+            else
+                attach(mmap(0, length, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0), length);
+            if (length < old_length && ftruncate(_fd, (off_t)length) != 0)
+                throw error("cannot shrink", "mapping");
+        }
+
+        void    attach(void *address, size_type length)
+        {
+            if (address == MAP_FAILED)
+                throw error("cannot map", "mapping");
+            _address = address;
+            _length = length;
+            _header = static_cast<header *>(_address);
+            _data = reinterpret_cast<pointer>(_header + 1);
+            _capacity = (_length - sizeof(header)) / sizeof(value_type);
+        }
+    };
+
+    template <class T>
+    bool    operator==(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T>
+    bool    operator!=(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T>
+    bool    operator<(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T>
+    bool    operator<=(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T>
+    bool    operator>(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T>
+    bool    operator>=(const ft::mapped_vector<T> &lhs, const ft::mapped_vector<T> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+}
+
+#endif
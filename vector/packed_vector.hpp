@@ -0,0 +1,291 @@
+#ifndef PACKED_VECTOR_HPP
+#define PACKED_VECTOR_HPP
+
+#include <stdexcept>
+#include <stdint.h>
+#include "vector.hpp"
+#include "../iterator/packed_iterator.hpp"
+#include "../utilities/atomic.hpp"
+#include "../utilities/bit_packing.hpp"
+
+namespace ft
+{
+    template <class T>
+    class packed_vector
+    {
+    public:
+        typedef T                                       value_type;
+        typedef size_t                                  size_type;
+        typedef std::ptrdiff_t                          difference_type;
+        typedef T                                       reference;
+        typedef T                                       const_reference;
+        typedef ft::packed_iterator<packed_vector>      const_iterator;
+        typedef const_iterator                          iterator;
+
+        enum { block_size = bits::pack_block, anchor_step = 16, anchors = block_size / anchor_step - 1 };
+
+        packed_vector() : _size(0), _epoch(0) {}
+
+        template <class InputIterator>
+        packed_vector(InputIterator first, InputIterator last,
+                      typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+            : _size(0), _epoch(0)
+        {
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        const_iterator  begin() const
+        {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator  end() const
+        {
+            return const_iterator(this, _size);
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        size_type   block_count() const
+        {
+            return (_size + block_size - 1) / block_size;
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            size_type   block = pos / block_size;
+            size_type   offset = pos % block_size;
+
+            if (block == _blocks.size())
+                return _tail[offset];
+
+            const header    &head = _blocks[block];
+
+            if (!head.delta)
+                return (T)(head.base + bits::extract(packed(head), head.width, offset));
+
+            size_type   anchor = offset / anchor_step;
+            uint64_t    value = head.base;
+
+            if (anchor)
+                value += bits::read_bits(anchored(head), (anchor - 1) * head.anchor_width, head.anchor_width);
+            for (size_type i = anchor * anchor_step + 1; i <= offset; ++i)
+                value += bits::extract(packed(head), head.width, i);
+            return (T)value;
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos < _size)
+                return (*this)[pos];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        const_reference front() const
+        {
+            return (*this)[0];
+        }
+
+        const_reference back() const
+        {
+            return (*this)[_size - 1];
+        }
+
+        const_reference decoded(size_type pos) const
+        {
+            size_type   block = pos / block_size;
+
+            if (block == _blocks.size())
+                return _tail[pos % block_size];
+            return decoded_block(block)[pos % block_size];
+        }
+
+        size_type   decode(size_type block, T *out) const
+        {
+            if (block == _blocks.size())
+            {
+                size_type   count = _size - block * block_size;
+
+                for (size_type i = 0; i < count; ++i)
+                    out[i] = _tail[i];
+                return count;
+            }
+
+            const header    &head = _blocks[block];
+            uint64_t        values[block_size];
+            uint64_t        value = head.base;
+
+            bits::unpack(packed(head), head.width, values);
+            if (head.delta)
+                for (size_type i = 0; i < block_size; ++i)
+                {
+                    value += values[i];
+                    out[i] = (T)value;
+                }
+            else
+                for (size_type i = 0; i < block_size; ++i)
+                    out[i] = (T)(value + values[i]);
+            return block_size;
+        }
+
+        void    copy(T *out) const
+        {
+            for (size_type block = 0; block < block_count(); ++block)
+                out += decode(block, out);
+        }
+
+        void    push_back(const T &value)
+        {
+            _tail[_size % block_size] = value;
+            if (++_size % block_size == 0)
+                seal();
+        }
+
+        void    clear()
+        {
+            _words.clear();
+            _blocks.clear();
+            _size = 0;
+            _epoch = 0;
+        }
+
+        void    swap(packed_vector &other)
+        {
+            _words.swap(other._words);
+            _blocks.swap(other._blocks);
+            for (size_type i = 0; i < block_size; ++i)
+                ft::swap(_tail[i], other._tail[i]);
+            ft::swap(_size, other._size);
+            ft::swap(_epoch, other._epoch);
+        }
+
+        void    shrink_to_fit()
+        {
+            _words.shrink_to_fit();
+            _blocks.shrink_to_fit();
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, _words.size() * sizeof(uint64_t),
+                                    sizeof(*this) + _words.capacity() * sizeof(uint64_t)
+                                    + _blocks.capacity() * sizeof(header));
+        }
+
+        double  bits_per_value() const
+        {
+            return _size ? (double)memory_usage().allocated_bytes * 8 / _size : 0;
+        }
+
+    private:
+        struct header
+        {
+            uint64_t    base;
+            uint32_t    offset;
+            uint8_t     width;
+            uint8_t     delta;
+            uint8_t     anchor_width;
+        };
+
+        struct cached_block
+        {
+            uint64_t    epoch;
+            size_type   block;
+            T           values[block_size];
+        };
+
+        enum { cached_blocks = 4 };
+
+        ft::vector<uint64_t>    _words;
+        ft::vector<header>      _blocks;
+        T                       _tail[block_size];
+        size_type               _size;
+        uint64_t                _epoch;
+
+        static uint64_t next_epoch()
+        {
+            static uint64_t epochs = 0;
+
+            return ft::atomic_fetch_add(&epochs, (uint64_t)1) + 1;
+        }
+
+        const T *decoded_block(size_type block) const
+        {
+            static thread_local cached_block    cache[cached_blocks];
+            cached_block                        &slot = cache[(block ^ _epoch) % cached_blocks];
+
+            if (slot.epoch != _epoch || slot.block != block)
+            {
+                decode(block, slot.values);
+                slot.epoch = _epoch;
+                slot.block = block;
+            }
+            return slot.values;
+        }
+
+        const uint64_t  *packed(const header &head) const
+        {
+            return head.width ? &_words[head.offset] : 0;
+        }
+
+        const uint64_t  *anchored(const header &head) const
+        {
+            return &_words[head.offset + bits::packed_words(head.width)];
+        }
+
+        void    seal()
+        {
+            uint64_t    values[block_size];
+            uint64_t    frame = 0;
+            uint64_t    gaps = 0;
+            bool        sorted = true;
+            T           low = _tail[0];
+            header      head;
+
+            for (size_type i = 1; i < block_size; ++i)
+            {
+                if (_tail[i] < low)
+                    low = _tail[i];
+                if (_tail[i] < _tail[i - 1])
+                    sorted = false;
+                gaps |= (uint64_t)_tail[i] - (uint64_t)_tail[i - 1];
+            }
+            for (size_type i = 0; i < block_size; ++i)
+                frame |= (uint64_t)_tail[i] - (uint64_t)low;
+            head.delta = sorted && bits::width_of(gaps) * block_size + bits::width_of(frame) * anchors
+                                   < bits::width_of(frame) * block_size;
+            head.width = (uint8_t)bits::width_of(head.delta ? gaps : frame);
+            head.anchor_width = head.delta ? (uint8_t)bits::width_of(frame) : 0;
+            head.base = head.delta ? (uint64_t)_tail[0] : (uint64_t)low;
+
+            size_type   words = bits::packed_words(head.width) + bits::words_for(anchors * head.anchor_width);
+
+            if (_words.size() + words > UINT32_MAX)
+                throw std::length_error("ERROR: packed_vector is too large");
+            head.offset = (uint32_t)_words.size();
+            for (size_type i = 0; i < block_size; ++i)
+                values[i] = head.delta ? (i ? (uint64_t)_tail[i] - (uint64_t)_tail[i - 1] : 0)
+                                       : (uint64_t)_tail[i] - head.base;
+            if (words)
+                _words.resize(_words.size() + words, 0);
+            if (head.width)
+                bits::pack(values, head.width, &_words[head.offset]);
+            for (size_type i = 0; i < anchors && head.anchor_width; ++i)
+                bits::write_bits(&_words[head.offset + bits::packed_words(head.width)], i * head.anchor_width,
+                                 head.anchor_width, (uint64_t)_tail[(i + 1) * anchor_step] - head.base);
+            _blocks.push_back(head);
+            _epoch = next_epoch();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,357 @@
+#ifndef STABLE_VECTOR_HPP
+#define STABLE_VECTOR_HPP
+
+#include <new>
+#include <stdexcept>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "../iterator/random_access_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+
+namespace ft
+{
+    template <class T>
+    class stable_vector
+    {
+    public:
+        typedef T                                                       value_type;
+        typedef std::size_t                                             size_type;
+        typedef T                                                       &reference;
+        typedef const T                                                 &const_reference;
+        typedef T                                                       *pointer;
+        typedef const T                                                 *const_pointer;
+        typedef ft::random_access_iterator<value_type>                  iterator;
+        typedef ft::random_access_iterator<const value_type>            const_iterator;
+        typedef ft::reverse_iterator<iterator>                          reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                    const_reverse_iterator;
+        typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+
+        enum { default_reservation = (size_type)1 << 36 };
+
+        explicit    stable_vector(size_type max_elements = default_reservation / sizeof(T))
+            : _data(0), _size(0), _committed(0), _reserved(0)
+        {
+            reserve_address_space(max_elements);
+        }
+
+        stable_vector(const stable_vector &other) : _data(0), _size(0), _committed(0), _reserved(0)
+        {
+            reserve_address_space(other.max_size());
+            reserve(other._size);
+            for (; _size < other._size; ++_size)
+                new (_data + _size) value_type(other._data[_size]);
+        }
+
+        ~stable_vector()
+        {
+            clear();
+            if (_data)
+                munmap(_data, _reserved);
+        }
+
+        stable_vector   &operator=(const stable_vector &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                reserve(other._size);
+                for (; _size < other._size; ++_size)
+                    new (_data + _size) value_type(other._data[_size]);
+            }
+            return *this;
+        }
+
+        iterator        begin()
+        {
+            return _data;
+        }
+
+        const_iterator  begin() const
+        {
+            return _data;
+        }
+
+        iterator        end()
+        {
+            return _data + _size;
+        }
+
+        const_iterator  end() const
+        {
+            return _data + _size;
+        }
+
+        reverse_iterator        rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator        rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        size_type   max_size() const
+        {
+            return _reserved / sizeof(value_type);
+        }
+
+        size_type   capacity() const
+        {
+            return _committed / sizeof(value_type);
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, _size * sizeof(value_type), sizeof(*this) + _committed);
+        }
+
+        void    reserve(size_type count)
+        {
+            if (count > max_size())
+                throw std::length_error("ERROR: stable_vector reservation exceeded");
+            if (count > capacity())
+                commit(count * sizeof(value_type));
+        }
+
+        void    shrink_to_fit()
+        {
+            size_type   keep = round_up(_size * sizeof(value_type));
+
+            if (keep >= _committed)
+                return;
+            madvise((char *)_data + keep, _committed - keep, MADV_DONTNEED);
+            mprotect((char *)_data + keep, _committed - keep, PROT_NONE);
+            _committed = keep;
+        }
+
+        void    resize(size_type count, value_type value = value_type())
+        {
+            reserve(count);
+            while (_size > count)
+                pop_back();
+            for (; _size < count; ++_size)
+                new (_data + _size) value_type(value);
+        }
+
+        reference       operator[](size_type index)
+        {
+            return _data[index];
+        }
+
+        const_reference operator[](size_type index) const
+        {
+            return _data[index];
+        }
+
+        reference       at(size_type index)
+        {
+            if (index < _size)
+                return _data[index];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        const_reference at(size_type index) const
+        {
+            if (index < _size)
+                return _data[index];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        reference       front()
+        {
+            return _data[0];
+        }
+
+        const_reference front() const
+        {
+            return _data[0];
+        }
+
+        reference       back()
+        {
+            return _data[_size - 1];
+        }
+
+        const_reference back() const
+        {
+            return _data[_size - 1];
+        }
+
+        pointer         data()
+        {
+            return _data;
+        }
+
+        const_pointer   data() const
+        {
+            return _data;
+        }
+
+        void    assign(size_type count, const value_type &value)
+        {
+            clear();
+            resize(count, value);
+        }
+
+        void    clear()
+        {
+            while (_size)
+                _data[--_size].~value_type();
+        }
+
+        void    push_back(const value_type &value)
+        {
+            if ((_size + 1) * sizeof(value_type) > _committed)
+                reserve(_size + 1);
+            new (_data + _size) value_type(value);
+            ++_size;
+        }
+
+        void    pop_back()
+        {
+            if (_size)
+                _data[--_size].~value_type();
+        }
+
+        iterator    insert(iterator pos, const value_type &value)
+        {
+            size_type   index = ft::distance(begin(), pos);
+            value_type  copy(value);
+
+            if (index == _size)
+                push_back(copy);
+            else
+            {
+                push_back(_data[_size - 1]);
+                for (size_type i = _size - 2; i > index; --i)
+                    _data[i] = _data[i - 1];
+                _data[index] = copy;
+            }
+            return begin() + index;
+        }
+
+        iterator    erase(iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator    erase(iterator first, iterator last)
+        {
+            size_type   index = ft::distance(begin(), first);
+            size_type   count = ft::distance(first, last);
+
+            for (size_type i = index; i + count < _size; ++i)
+                _data[i] = _data[i + count];
+            for (size_type i = 0; i < count; ++i)
+                pop_back();
+            return begin() + index;
+        }
+
+        void    swap(stable_vector &other)
+        {
+            ft::swap(_data, other._data);
+            ft::swap(_size, other._size);
+            ft::swap(_committed, other._committed);
+            ft::swap(_reserved, other._reserved);
+        }
+
+    private:
+        pointer     _data;
+        size_type   _size;
+        size_type   _committed;
+        size_type   _reserved;
+
+        static size_type    round_up(size_type bytes)
+        {
+            size_type   page = (size_type)sysconf(_SC_PAGESIZE);
+
+            return (bytes + page - 1) / page * page;
+        }
+
+        void    reserve_address_space(size_type max_elements)
+        {
+            _reserved = round_up(max_elements * sizeof(value_type));
+            if (!_reserved)
+                return;
+
+            void    *address = mmap(0, _reserved, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+
+            if (address == MAP_FAILED)
+                throw std::bad_alloc();
+            _data = static_cast<pointer>(address);
+        }
+
+        void    commit(size_type bytes)
+        {
+            size_type   step = _committed / 4 > 65536 ? _committed / 4 : 65536;
+            size_type   target = round_up(bytes > _committed + step ? bytes : _committed + step);
+
+            if (target > _reserved)
+                target = _reserved;
+            if (mprotect((char *)_data + _committed, target - _committed, PROT_READ | PROT_WRITE) != 0)
+                throw std::bad_alloc();
+            _committed = target;
+        }
+    };
+
+    template <class T>
+    bool    operator==(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template <class T>
+    bool    operator!=(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template <class T>
+    bool    operator<(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <class T>
+    bool    operator<=(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    template <class T>
+    bool    operator>(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    template <class T>
+    bool    operator>=(const ft::stable_vector<T> &lhs, const ft::stable_vector<T> &rhs)
+    {
+        return !(lhs < rhs);
+    }
+}
+
+#endif
@@ -77,6 +77,7 @@ namespace ft
         vector(const vector &vec)
         {
             _allocator = vec._allocator;
+            _shrink_policy = vec._shrink_policy;
             _capacity = vec._capacity;
             _size = vec._size;
             _data = _allocator.allocate(_capacity);
@@ -89,6 +90,7 @@ namespace ft
             if (this != &vec)
             {
                 _allocator.deallocate(_data, _capacity);
+                _shrink_policy = vec._shrink_policy;
                 _capacity = vec._capacity;
                 _size = vec._size;
                 _data = _allocator.allocate(_capacity);
@@ -169,21 +171,26 @@ namespace ft
         void reserve(size_type size)
         {
             if (size > _capacity && size < max_size())
-            {
-                pointer tmp = _allocator.allocate(size);
-                try
-                {
-                    std::uninitialized_copy(_data, _data + _size, tmp);
-                }
-                catch (...)
-                {
-                    _allocator.deallocate(tmp, size);
-                    throw;
-                }
-                _allocator.deallocate(_data, _capacity);
-                _data = tmp;
-                _capacity = size;
-            }
+                reallocate(size);
+        }
+
+        void    shrink_to_fit()
+        {
+            if (_size < _capacity)
+                reallocate(_size);
+        }
+
+        // With a policy enabled, pop_back, erase and clear may reallocate. That
+        // invalidates every iterator, pointer and reference, even before the erase point.
+        void    set_shrink_policy(const shrink_policy &policy)
+        {
+            _shrink_policy = policy;
+            apply_shrink_policy();
+        }
+
+        shrink_policy   get_shrink_policy() const
+        {
+            return _shrink_policy;
         }
 
         reference   operator[](size_type size)
@@ -201,6 +208,11 @@ namespace ft
             return _allocator;
         }
 
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, _size * sizeof(value_type), sizeof(*this) + _capacity * sizeof(value_type));
+        }
+
         reference       at(size_type size)
         {
             if (size < _size)
@@ -271,63 +283,52 @@ namespace ft
         {
             while (_size > 0)
                 _allocator.destroy(_data + (--_size));
+            apply_shrink_policy();
         }
 
         iterator    insert(iterator pos, const value_type& value)
         {
             size_type   distance = ft::distance(begin(), pos);
-            if (_size < _capacity)
-            {
-                for (iterator it = end(); it != pos - 1; --it)
-                    _allocator.construct(&(*it), *(it - 1));
-                _allocator.construct(&(*pos), value);
-                _size++;
-            }
+            value_type  copy(value);
+
+            if (_size == _capacity)
+                reserve(_capacity ? _capacity * 2 : 1);
+            if (distance == _size)
+                _allocator.construct(_data + _size, copy);
             else
             {
-                value_type *tmp_data = (_capacity ? _allocator.allocate(_capacity * 2) : _allocator.allocate(1));
-                size_type i = 0;
-                for (iterator it = begin(); it != end(); ++it)
-                {
-                    if (it == pos)
-                        _allocator.construct(tmp_data + i++, value);
-                    _allocator.construct(tmp_data + i++, *it);
-                    _allocator.destroy(&(*it));
-                }
-                size_type tmp_capacity = (_capacity ? _capacity * 2 : 1);
-                _allocator.deallocate(_data,_capacity);
-                _data = tmp_data;
-                _size++;
-                _capacity = tmp_capacity;
+                _allocator.construct(_data + _size, _data[_size - 1]);
+                for (size_type i = _size - 1; i > distance; --i)
+                    _data[i] = _data[i - 1];
+                _data[distance] = copy;
             }
+            _size++;
             return begin() + distance;
         }
 
         void    insert(iterator pos, size_type count, const value_type& value)
         {
+            size_type   distance = pos - begin();
+            value_type  copy(value);
+
+            if (!count)
+                return;
             if (_size + count > _capacity)
+                reserve(_size + count > _capacity * 2 ? _size + count : _capacity * 2);
+            for (size_type i = _size; i > distance; --i)
             {
-                if (_size + count >= _capacity * 2)
-                    _capacity = _size + count;
+                if (i - 1 + count >= _size)
+                    _allocator.construct(_data + i - 1 + count, _data[i - 1]);
                 else
-                    _capacity *= 2;
+                    _data[i - 1 + count] = _data[i - 1];
             }
-            value_type  *tmp_data = _allocator.allocate(_capacity);
-            value_type  *p_tmp_data = tmp_data;
-            for (int i = 0; begin() + i < pos; ++i)
+            for (size_type i = distance; i < distance + count; ++i)
             {
-                _allocator.construct(p_tmp_data++, *(begin() + i));
-                _allocator.destroy(&(*(begin() + i)));
-            }
-            for (size_type i = 0; i < count; ++i)
-                _allocator.construct(p_tmp_data++, value);
-            for (int i = 0; pos + i < end(); ++i)
-            {
-                _allocator.construct(p_tmp_data++, *(pos + i));
-                _allocator.destroy(&(*(pos + i)));
+                if (i < _size)
+                    _data[i] = copy;
+                else
+                    _allocator.construct(_data + i, copy);
             }
-            _allocator.deallocate(&(*begin()), _size);
-            _data = tmp_data;
             _size += count;
         }
 
@@ -372,34 +373,28 @@ namespace ft
 
         iterator    erase(iterator position)
         {
-            size_type   count = 0;
-            for (iterator it = this->begin(); it != position; ++it)
-            {
-                count++;
-            }
-            for (size_type i = 0; i < _size; ++i)
-            {
-                if (i == count)
-                    _allocator.destroy(_data + count);
-                if (i > count)
-                    _allocator.construct(_data + i - 1, _data[i]);
-            }
+            size_type   index = ft::distance(begin(), position);
+
+            for (size_type i = index + 1; i < _size; ++i)
+                _data[i - 1] = _data[i];
+            _allocator.destroy(_data + _size - 1);
             --_size;
-            return (iterator(_data + count));
+            apply_shrink_policy();
+            return (iterator(_data + index));
         }
 
         iterator    erase(iterator first, iterator last)
         {
-            iterator tmp = first;
-            size_type distance = ft::distance(first, last);
-            for ( ;tmp < end() - distance; ++tmp)
-            {
-                _allocator.destroy(&(*tmp));
-                _allocator.construct(&(*tmp), *(tmp +  distance));
-                _allocator.destroy(&(*(tmp + distance)));
-            }
+            size_type   index = ft::distance(begin(), first);
+            size_type   distance = ft::distance(first, last);
+
+            for (size_type i = index; i + distance < _size; ++i)
+                _data[i] = _data[i + distance];
+            for (size_type i = _size - distance; i < _size; ++i)
+                _allocator.destroy(_data + i);
             _size -= distance;
-            return first;
+            apply_shrink_policy();
+            return (iterator(_data + index));
         }
 
         void    swap(vector &vec)
@@ -407,6 +402,8 @@ namespace ft
             ft::swap(_data, vec._data);
             ft::swap(_size, vec._size);
             ft::swap(_capacity, vec._capacity);
+            ft::swap(_allocator, vec._allocator);
+            ft::swap(_shrink_policy, vec._shrink_policy);
         }
 
         void    push_back(const value_type &value)
@@ -423,6 +420,7 @@ namespace ft
             {
                 _allocator.destroy(&(*(end() - 1)));
                 _size--;
+                apply_shrink_policy();
             }
         }
 
@@ -431,6 +429,40 @@ namespace ft
         value_type      *_data;
         size_type       _capacity;
         size_type       _size;
+        shrink_policy   _shrink_policy;
+
+        void    reallocate(size_type capacity)
+        {
+            pointer tmp = capacity ? _allocator.allocate(capacity) : nullptr;
+
+            try
+            {
+                std::uninitialized_copy(_data, _data + _size, tmp);
+            }
+            catch (...)
+            {
+                if (tmp)
+                    _allocator.deallocate(tmp, capacity);
+                throw;
+            }
+            for (size_type i = 0; i < _size; ++i)
+                _allocator.destroy(_data + i);
+            if (_data)
+                _allocator.deallocate(_data, _capacity);
+            _data = tmp;
+            _capacity = capacity;
+        }
+
+        void    apply_shrink_policy()
+        {
+            if (_shrink_policy.enabled())
+            {
+                size_type   target = _shrink_policy.target(_size, _capacity);
+
+                if (target < _capacity)
+                    reallocate(target);
+            }
+        }
     };
 
     template<class T, class Allocator>
@@ -476,4 +508,6 @@ namespace ft
     }
 }
 
+#include "vector_bool.hpp"
+
 #endif
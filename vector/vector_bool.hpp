@@ -0,0 +1,459 @@
+#ifndef VECTOR_BOOL_HPP
+#define VECTOR_BOOL_HPP
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <stdint.h>
+#include "../iterator/bit_iterator.hpp"
+#include "../iterator/reverse_iterator.hpp"
+#include "../utilities/utilities.hpp"
+#include "../utilities/bit_words.hpp"
+
+namespace ft
+{
+    template <class T, class Allocator>
+    class vector;
+
+    template <class Allocator>
+    class vector<bool, Allocator>
+    {
+    public:
+        typedef bool                                                            value_type;
+        typedef Allocator                                                       allocator_type;
+        typedef typename allocator_type::size_type                              size_type;
+        typedef std::ptrdiff_t                                                  difference_type;
+        typedef ft::bit_reference                                               reference;
+        typedef bool                                                            const_reference;
+        typedef ft::bit_iterator<uint64_t>                                      iterator;
+        typedef ft::bit_iterator<const uint64_t>                                const_iterator;
+        typedef ft::reverse_iterator<iterator>                                  reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                            const_reverse_iterator;
+        typedef typename Allocator::template rebind<uint64_t>::other            word_allocator_type;
+
+        explicit    vector(const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _words(0), _size(0), _capacity(0) {}
+
+        explicit    vector(size_type size, bool value = false, const allocator_type &alloc = allocator_type())
+            : _allocator(alloc), _words(0), _size(0), _capacity(0)
+        {
+            assign(size, value);
+        }
+
+        template <class InputIterator>
+        vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
+               typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+            : _allocator(alloc), _words(0), _size(0), _capacity(0)
+        {
+            assign(first, last);
+        }
+
+        vector(const vector &other) : _allocator(other._allocator), _words(0), _size(0), _capacity(0)
+        {
+            *this = other;
+        }
+
+        ~vector()
+        {
+            if (_words)
+                _allocator.deallocate(_words, _capacity);
+        }
+
+        vector  &operator=(const vector &other)
+        {
+            if (this != &other)
+            {
+                clear();
+                reserve(other._size);
+                if (other._size)
+                    std::memcpy(_words, other._words, bits::words_for(other._size) * sizeof(uint64_t));
+                _size = other._size;
+            }
+            return *this;
+        }
+
+        iterator                begin()
+        {
+            return iterator(_words, 0);
+        }
+
+        const_iterator          begin() const
+        {
+            return const_iterator(_words, 0);
+        }
+
+        iterator                end()
+        {
+            return iterator(_words, _size);
+        }
+
+        const_iterator          end() const
+        {
+            return const_iterator(_words, _size);
+        }
+
+        reverse_iterator        rbegin()
+        {
+            return reverse_iterator(end());
+        }
+
+        const_reverse_iterator  rbegin() const
+        {
+            return const_reverse_iterator(end());
+        }
+
+        reverse_iterator        rend()
+        {
+            return reverse_iterator(begin());
+        }
+
+        const_reverse_iterator  rend() const
+        {
+            return const_reverse_iterator(begin());
+        }
+
+        size_type   size() const
+        {
+            return _size;
+        }
+
+        size_type   max_size() const
+        {
+            size_type   words = _allocator.max_size();
+
+            return words > (size_type)-1 / bits::word_bits ? (size_type)-1 : words * bits::word_bits;
+        }
+
+        size_type   capacity() const
+        {
+            return _capacity * bits::word_bits;
+        }
+
+        bool        empty() const
+        {
+            return !_size;
+        }
+
+        allocator_type  get_allocator() const
+        {
+            return allocator_type(_allocator);
+        }
+
+        memory_footprint    memory_usage() const
+        {
+            return memory_footprint(_size, bits::words_for(_size) * sizeof(uint64_t),
+                                    sizeof(*this) + _capacity * sizeof(uint64_t));
+        }
+
+        void        reserve(size_type size)
+        {
+            if (bits::words_for(size) > _capacity)
+                reallocate(bits::words_for(size));
+        }
+
+        void        shrink_to_fit()
+        {
+            if (bits::words_for(_size) < _capacity)
+                reallocate(bits::words_for(_size));
+        }
+
+        void        resize(size_type size, bool value = false)
+        {
+            if (size < _size)
+                truncate(size);
+            else
+                insert(end(), size - _size, value);
+        }
+
+        reference       operator[](size_type pos)
+        {
+            return reference(_words + pos / bits::word_bits, (uint64_t)1 << (pos % bits::word_bits));
+        }
+
+        const_reference operator[](size_type pos) const
+        {
+            return (_words[pos / bits::word_bits] >> (pos % bits::word_bits)) & 1;
+        }
+
+        reference       at(size_type pos)
+        {
+            if (pos < _size)
+                return (*this)[pos];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        const_reference at(size_type pos) const
+        {
+            if (pos < _size)
+                return (*this)[pos];
+            throw std::out_of_range("ERROR: position out of range");
+        }
+
+        reference       front()
+        {
+            return (*this)[0];
+        }
+
+        const_reference front() const
+        {
+            return (*this)[0];
+        }
+
+        reference       back()
+        {
+            return (*this)[_size - 1];
+        }
+
+        const_reference back() const
+        {
+            return (*this)[_size - 1];
+        }
+
+        void    assign(size_type size, bool value)
+        {
+            size_type   words = bits::words_for(size);
+
+            clear();
+            reserve(size);
+            if (words)
+            {
+                std::memset(_words, value ? 0xff : 0, words * sizeof(uint64_t));
+                _words[words - 1] &= bits::tail_mask(size);
+            }
+            _size = size;
+        }
+
+        template <class InputIterator>
+        void    assign(InputIterator first, InputIterator last,
+                       typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            clear();
+            for (; first != last; ++first)
+                push_back(*first);
+        }
+
+        void    clear()
+        {
+            truncate(0);
+        }
+
+        void    push_back(bool value)
+        {
+            if (_size == capacity())
+                reallocate(_capacity ? _capacity * 2 : 1);
+            if (value)
+                _words[_size / bits::word_bits] |= (uint64_t)1 << (_size % bits::word_bits);
+            ++_size;
+        }
+
+        void    pop_back()
+        {
+            if (_size)
+                truncate(_size - 1);
+        }
+
+        iterator    insert(iterator pos, bool value)
+        {
+            size_type   index = pos.index();
+
+            insert(pos, 1, value);
+            return begin() + index;
+        }
+
+        void        insert(iterator pos, size_type count, bool value)
+        {
+            size_type   index = pos.index();
+            size_type   old_size = _size;
+
+            if (!count)
+                return;
+            if (old_size + count > capacity())
+                reallocate(bits::words_for(old_size + count) > _capacity * 2
+                           ? bits::words_for(old_size + count) : _capacity * 2);
+            _size = old_size + count;
+            bits::move_bits(_words, index + count, index, old_size - index);
+            fill(index, index + count, value);
+        }
+
+        template <class InputIterator>
+        void        insert(iterator pos, InputIterator first, InputIterator last,
+                           typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type* = nullptr)
+        {
+            vector      values(first, last);
+            size_type   index = pos.index();
+
+            insert(pos, values.size(), false);
+            for (size_type i = 0; i < values.size(); ++i)
+                (*this)[index + i] = values[i];
+        }
+
+        iterator    erase(iterator position)
+        {
+            return erase(position, position + 1);
+        }
+
+        iterator    erase(iterator first, iterator last)
+        {
+            size_type   index = first.index();
+            size_type   count = last.index() - index;
+
+            bits::move_bits(_words, index, index + count, _size - index - count);
+            truncate(_size - count);
+            return begin() + index;
+        }
+
+        void    swap(vector &other)
+        {
+            ft::swap(_words, other._words);
+            ft::swap(_size, other._size);
+            ft::swap(_capacity, other._capacity);
+            ft::swap(_allocator, other._allocator);
+        }
+
+        static void swap(reference lhs, reference rhs)
+        {
+            ft::swap(lhs, rhs);
+        }
+
+        void    flip()
+        {
+            size_type   words = bits::words_for(_size);
+
+            bits::flip_words(_words, words);
+            if (words)
+                _words[words - 1] &= bits::tail_mask(_size);
+        }
+
+        size_type   count() const
+        {
+            return bits::count(_words, bits::words_for(_size));
+        }
+
+        size_type   find_first_set() const
+        {
+            return find_next_set(0);
+        }
+
+        size_type   find_next_set(size_type pos) const
+        {
+            if (pos >= _size)
+                return _size;
+
+            size_type   found = bits::find_set(_words, bits::words_for(_size), pos);
+
+            return found < _size ? found : _size;
+        }
+
+        size_type   find_first_unset() const
+        {
+            return find_next_unset(0);
+        }
+
+        size_type   find_next_unset(size_type pos) const
+        {
+            if (pos >= _size)
+                return _size;
+
+            size_type   found = bits::find_unset(_words, bits::words_for(_size), pos);
+
+            return found < _size ? found : _size;
+        }
+
+        vector  &operator&=(const vector &other)
+        {
+            check_size(other);
+            bits::and_words(_words, other._words, bits::words_for(_size));
+            return *this;
+        }
+
+        vector  &operator|=(const vector &other)
+        {
+            check_size(other);
+            bits::or_words(_words, other._words, bits::words_for(_size));
+            return *this;
+        }
+
+        vector  &operator^=(const vector &other)
+        {
+            check_size(other);
+            bits::xor_words(_words, other._words, bits::words_for(_size));
+            return *this;
+        }
+
+        const uint64_t  *words() const
+        {
+            return _words;
+        }
+
+        size_type       word_count() const
+        {
+            return bits::words_for(_size);
+        }
+
+    private:
+        word_allocator_type _allocator;
+        uint64_t            *_words;
+        size_type           _size;
+        size_type           _capacity;
+
+        void    reallocate(size_type words)
+        {
+            uint64_t    *tmp = words ? _allocator.allocate(words) : 0;
+            size_type   used = bits::words_for(_size);
+
+            if (words)
+            {
+                if (used)
+                    std::memcpy(tmp, _words, used * sizeof(uint64_t));
+                std::memset(tmp + used, 0, (words - used) * sizeof(uint64_t));
+            }
+            if (_words)
+                _allocator.deallocate(_words, _capacity);
+            _words = tmp;
+            _capacity = words;
+        }
+
+        void    truncate(size_type size)
+        {
+            size_type   words = bits::words_for(size);
+
+            if (size >= _size)
+                return;
+            std::memset(_words + words, 0, (bits::words_for(_size) - words) * sizeof(uint64_t));
+            if (words)
+                _words[words - 1] &= bits::tail_mask(size);
+            _size = size;
+        }
+
+        void    fill(size_type first, size_type last, bool value)
+        {
+            for (; first < last && first % bits::word_bits; ++first)
+                (*this)[first] = value;
+            for (; first + bits::word_bits <= last; first += bits::word_bits)
+                _words[first / bits::word_bits] = value ? ~(uint64_t)0 : 0;
+            for (; first < last; ++first)
+                (*this)[first] = value;
+        }
+
+        void    check_size(const vector &other) const
+        {
+            if (other._size != _size)
+                throw std::invalid_argument("ERROR: bitwise operation on vectors of different sizes");
+        }
+    };
+
+    template <class Allocator>
+    bool    operator==(const ft::vector<bool, Allocator> &lhs, const ft::vector<bool, Allocator> &rhs)
+    {
+        return lhs.size() == rhs.size()
+               && !std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(uint64_t));
+    }
+
+    template <class Allocator>
+    bool    operator!=(const ft::vector<bool, Allocator> &lhs, const ft::vector<bool, Allocator> &rhs)
+    {
+        return !(lhs == rhs);
+    }
+}
+
+#endif